@@ -0,0 +1,250 @@
+#include <cstring>
+
+#include "../onnxruntime_server.hpp"
+
+Orts::onnx::batch_scheduler::batch_scheduler(session &owner, int64_t max_batch_size, long max_queue_delay_us)
+	: owner(owner), max_batch_size(max_batch_size), max_queue_delay(max_queue_delay_us), allocator() {
+	worker = std::thread([this] { loop(); });
+}
+
+Orts::onnx::batch_scheduler::~batch_scheduler() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	condition.notify_all();
+	worker.join();
+
+	for (auto &req : queue) {
+		complete(*req, {}, std::make_exception_ptr(runtime_error("session destroyed")));
+	}
+	queue.clear();
+}
+
+std::vector<Ort::Value>
+Orts::onnx::batch_scheduler::run(const std::vector<Ort::Value> &input_values, deadline_t deadline) {
+	std::promise<std::vector<Ort::Value>> result;
+	auto future = result.get_future();
+	submit(input_values, deadline, [&result](std::vector<Ort::Value> &outputs, std::exception_ptr error) {
+		if (error != nullptr)
+			result.set_exception(error);
+		else
+			result.set_value(std::move(outputs));
+	});
+	return future.get();
+}
+
+void Orts::onnx::batch_scheduler::submit(
+	const std::vector<Ort::Value> &input_values, deadline_t deadline, completion_t done
+) {
+	auto req = std::make_shared<request>();
+	req->input_values = &input_values;
+	req->rows = count_rows(input_values);
+	req->enqueued_at = std::chrono::steady_clock::now();
+	req->deadline = deadline;
+	req->done = std::move(done);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (stop)
+			throw runtime_error("session destroyed");
+		queue.push_back(req);
+	}
+	condition.notify_one();
+}
+
+void Orts::onnx::batch_scheduler::loop() {
+	while (true) {
+		std::vector<std::shared_ptr<request>> expired;
+		std::vector<std::shared_ptr<request>> batch;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return stop || !queue.empty(); });
+			if (stop)
+				return;
+
+			// wait for more requests until the oldest one has waited long enough or the batch is full
+			auto deadline = queue.front()->enqueued_at + max_queue_delay;
+			condition.wait_until(lock, deadline, [this] { return stop || queued_rows() >= max_batch_size; });
+			if (stop)
+				return;
+
+			expired = take_expired();
+			if (!queue.empty())
+				batch = take_batch();
+		}
+
+		// completions run without the lock, so that they may take their time or queue the next request
+		for (auto &req : expired)
+			complete(
+				*req, {}, std::make_exception_ptr(gateway_timeout_error("Deadline exceeded while waiting for a batch"))
+			);
+		if (!batch.empty())
+			execute(batch);
+	}
+}
+
+int64_t Orts::onnx::batch_scheduler::queued_rows() {
+	auto &front = *queue.front();
+	if (front.rows < 0)
+		return max_batch_size;
+
+	int64_t rows = 0;
+	for (auto &req : queue) {
+		if (is_compatible(front, *req))
+			rows += req->rows;
+	}
+	return rows;
+}
+
+std::vector<std::shared_ptr<Orts::onnx::batch_scheduler::request>> Orts::onnx::batch_scheduler::take_expired() {
+	// nobody waits for these anymore, so they are not worth a slot in the batch
+	std::vector<std::shared_ptr<request>> expired;
+	for (auto it = queue.begin(); it != queue.end();) {
+		if (run_watchdog::expired((*it)->deadline)) {
+			expired.push_back(*it);
+			it = queue.erase(it);
+		} else {
+			++it;
+		}
+	}
+	return expired;
+}
+
+std::vector<std::shared_ptr<Orts::onnx::batch_scheduler::request>> Orts::onnx::batch_scheduler::take_batch() {
+	std::vector<std::shared_ptr<request>> batch;
+	batch.push_back(queue.front());
+	queue.pop_front();
+
+	auto &front = *batch.front();
+	if (front.rows < 0)
+		return batch;
+
+	int64_t rows = front.rows;
+	for (auto it = queue.begin(); it != queue.end() && rows < max_batch_size;) {
+		auto &req = *it;
+		if (is_compatible(front, *req) && rows + req->rows <= max_batch_size) {
+			rows += req->rows;
+			batch.push_back(req);
+			it = queue.erase(it);
+		} else {
+			++it;
+		}
+	}
+	return batch;
+}
+
+void Orts::onnx::batch_scheduler::execute(std::vector<std::shared_ptr<request>> &batch) {
+	std::vector<std::vector<Ort::Value>> results;
+	std::exception_ptr error;
+	try {
+		results = run_batch(batch);
+	} catch (...) {
+		error = std::current_exception();
+	}
+
+	for (size_t r = 0; r < batch.size(); r++)
+		complete(*batch[r], error == nullptr ? std::move(results[r]) : std::vector<Ort::Value>(), error);
+}
+
+std::vector<std::vector<Ort::Value>>
+Orts::onnx::batch_scheduler::run_batch(std::vector<std::shared_ptr<request>> &batch) {
+	if (batch.size() == 1) {
+		std::vector<std::vector<Ort::Value>> results;
+		results.emplace_back(owner.run_once(*batch.front()->input_values, batch.front()->deadline));
+		return results;
+	}
+
+	// a merged run is terminated only when every request in it has given up
+	int64_t total_rows = 0;
+	auto deadline = batch.front()->deadline;
+	for (auto &req : batch) {
+		total_rows += req->rows;
+		deadline = std::max(deadline, req->deadline);
+	}
+
+	// concatenate inputs along the batch dimension
+	auto &first_inputs = *batch.front()->input_values;
+	std::vector<Ort::Value> batch_inputs;
+	batch_inputs.reserve(first_inputs.size());
+	for (size_t i = 0; i < first_inputs.size(); i++) {
+		auto info = first_inputs[i].GetTensorTypeAndShapeInfo();
+		auto element_size = value_info::element_size(info.GetElementType());
+		auto shape = info.GetShape();
+		shape[0] = total_rows;
+
+		auto value = Ort::Value::CreateTensor(allocator, shape.data(), shape.size(), info.GetElementType());
+		auto dst = static_cast<char *>(value.GetTensorMutableRawData());
+		for (auto &req : batch) {
+			auto &src = (*req->input_values)[i];
+			auto bytes = src.GetTensorTypeAndShapeInfo().GetElementCount() * element_size;
+			std::memcpy(dst, src.GetTensorRawData(), bytes);
+			dst += bytes;
+		}
+		batch_inputs.emplace_back(std::move(value));
+	}
+
+	auto batch_outputs = owner.run_once(batch_inputs, deadline);
+
+	// scatter output rows back to each request
+	std::vector<std::vector<Ort::Value>> results(batch.size());
+	for (auto &output : batch_outputs) {
+		auto info = output.GetTensorTypeAndShapeInfo();
+		auto element_size = value_info::element_size(info.GetElementType());
+		auto shape = info.GetShape();
+		if (shape.empty() || shape[0] != total_rows)
+			throw runtime_error("Batched output does not have the batch dimension first");
+
+		auto row_bytes = total_rows > 0 ? info.GetElementCount() / total_rows * element_size : 0;
+		auto src = static_cast<const char *>(output.GetTensorRawData());
+		for (size_t r = 0; r < batch.size(); r++) {
+			shape[0] = batch[r]->rows;
+			auto value = Ort::Value::CreateTensor(allocator, shape.data(), shape.size(), info.GetElementType());
+			auto bytes = row_bytes * batch[r]->rows;
+			std::memcpy(value.GetTensorMutableRawData(), src, bytes);
+			src += bytes;
+			results[r].emplace_back(std::move(value));
+		}
+	}
+	return results;
+}
+
+void Orts::onnx::batch_scheduler::complete(request &req, std::vector<Ort::Value> outputs, std::exception_ptr error) {
+	try {
+		req.done(outputs, error);
+	} catch (std::exception &e) {
+		PLOG(L_WARNING) << "batch_scheduler: completion failed: " << e.what() << std::endl;
+	}
+}
+
+int64_t Orts::onnx::batch_scheduler::count_rows(const std::vector<Ort::Value> &input_values) {
+	// every input of a request must share the same batch size to be merged with other requests. empty batches run alone
+	int64_t rows = -1;
+	for (auto &value : input_values) {
+		auto shape = value.GetTensorTypeAndShapeInfo().GetShape();
+		if (shape.empty() || shape[0] <= 0)
+			return -1;
+		if (rows >= 0 && rows != shape[0])
+			return -1;
+		rows = shape[0];
+	}
+	return rows;
+}
+
+bool Orts::onnx::batch_scheduler::is_compatible(const request &a, const request &b) {
+	if (a.rows < 0 || b.rows < 0 || a.input_values->size() != b.input_values->size())
+		return false;
+
+	for (size_t i = 0; i < a.input_values->size(); i++) {
+		auto a_info = (*a.input_values)[i].GetTensorTypeAndShapeInfo();
+		auto b_info = (*b.input_values)[i].GetTensorTypeAndShapeInfo();
+		if (a_info.GetElementType() != b_info.GetElementType())
+			return false;
+
+		auto a_shape = a_info.GetShape();
+		auto b_shape = b_info.GetShape();
+		if (a_shape.size() != b_shape.size() || !std::equal(a_shape.begin() + 1, a_shape.end(), b_shape.begin() + 1))
+			return false;
+	}
+	return true;
+}
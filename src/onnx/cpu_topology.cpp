@@ -0,0 +1,166 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "../onnxruntime_server.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+Orts::onnx::cpu_topology::cpu_topology(std::map<int, std::vector<int>> cpus_by_node)
+	: cpus_by_node(std::move(cpus_by_node)) {
+}
+
+static std::map<int, std::vector<int>> read_host_topology() {
+	std::map<int, std::vector<int>> cpus_by_node;
+#ifdef __linux__
+	std::error_code ec;
+	for (auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+		auto name = entry.path().filename().string();
+		if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+			name.find_first_not_of("0123456789", 4) != std::string::npos)
+			continue;
+
+		std::ifstream file(entry.path() / "cpulist");
+		std::string list;
+		if (!std::getline(file, list))
+			continue;
+		try {
+			auto cpus = Orts::onnx::cpu_topology::parse_cpu_list(list);
+			if (!cpus.empty())
+				cpus_by_node[std::stoi(name.substr(4))] = cpus;
+		} catch (std::exception &) {
+			// leave a node the kernel describes in an unexpected way out
+		}
+	}
+#endif
+
+	if (cpus_by_node.empty()) {
+		auto &cpus = cpus_by_node[0];
+		for (int cpu = 0; cpu < (int)std::max(1U, std::thread::hardware_concurrency()); cpu++)
+			cpus.push_back(cpu);
+	}
+	return cpus_by_node;
+}
+
+const Orts::onnx::cpu_topology &Orts::onnx::cpu_topology::host() {
+	static const cpu_topology topology(read_host_topology());
+	return topology;
+}
+
+std::vector<int> Orts::onnx::cpu_topology::nodes() const {
+	std::vector<int> result;
+	for (auto &it : cpus_by_node)
+		result.push_back(it.first);
+	return result;
+}
+
+std::vector<int> Orts::onnx::cpu_topology::node_cpus(int node) const {
+	auto it = cpus_by_node.find(node);
+	if (it == cpus_by_node.end())
+		return {};
+	return it->second;
+}
+
+int Orts::onnx::cpu_topology::node_of(int cpu) const {
+	for (auto &it : cpus_by_node) {
+		if (std::binary_search(it.second.begin(), it.second.end(), cpu))
+			return it.first;
+	}
+	return -1;
+}
+
+std::vector<int> Orts::onnx::cpu_topology::worker_nodes(const std::vector<int> &cpus, long workers) const {
+	std::vector<int> nodes;
+	for (long i = 0; !cpus.empty() && i < workers; i++)
+		nodes.push_back(node_of(cpus[i % cpus.size()]));
+	return nodes;
+}
+
+std::vector<int> Orts::onnx::cpu_topology::parse_cpu_list(const std::string &list) {
+	std::vector<int> cpus;
+	std::stringstream stream(list);
+	std::string range;
+	while (std::getline(stream, range, ',')) {
+		range.erase(0, range.find_first_not_of(" \t\r\n"));
+		range.erase(range.find_last_not_of(" \t\r\n") + 1);
+		if (range.empty())
+			continue;
+
+		try {
+			size_t end = 0;
+			auto first = std::stoi(range, &end);
+			auto last = first;
+			if (end < range.size()) {
+				if (range[end] != '-')
+					throw std::invalid_argument(range);
+				size_t last_end = 0;
+				last = std::stoi(range.substr(end + 1), &last_end);
+				if (end + 1 + last_end != range.size())
+					throw std::invalid_argument(range);
+			}
+			if (first < 0 || last < first)
+				throw std::invalid_argument(range);
+			for (auto cpu = first; cpu <= last; cpu++)
+				cpus.push_back(cpu);
+		} catch (std::exception &) {
+			throw bad_request_error("Invalid CPU list: " + list);
+		}
+	}
+
+	std::sort(cpus.begin(), cpus.end());
+	cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+	return cpus;
+}
+
+std::string Orts::onnx::cpu_topology::to_cpu_list(const std::vector<int> &cpus) {
+	std::string list;
+	for (size_t i = 0; i < cpus.size();) {
+		auto j = i;
+		while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+			j++;
+		if (!list.empty())
+			list += ",";
+		list += std::to_string(cpus[i]);
+		if (j > i)
+			list += "-" + std::to_string(cpus[j]);
+		i = j + 1;
+	}
+	return list;
+}
+
+bool Orts::onnx::cpu_topology::pin_current_thread(const std::vector<int> &cpus) {
+#ifdef __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (auto cpu : cpus) {
+		if (cpu >= 0 && cpu < CPU_SETSIZE)
+			CPU_SET(cpu, &set);
+	}
+	return CPU_COUNT(&set) > 0 && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+	return false;
+#endif
+}
+
+Orts::onnx::cpu_topology::pin_scope::pin_scope(const std::vector<int> &cpus) {
+#ifdef __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+		return;
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (CPU_ISSET(cpu, &set))
+			previous.push_back(cpu);
+	}
+	if (!pin_current_thread(cpus))
+		previous.clear();
+#endif
+}
+
+Orts::onnx::cpu_topology::pin_scope::~pin_scope() {
+	if (!previous.empty())
+		pin_current_thread(previous);
+}
@@ -0,0 +1,17 @@
+#include "../onnxruntime_server.hpp"
+
+static Ort::Env create_env(bool global_thread_pools, long intra_op_threads, long inter_op_threads) {
+	if (!global_thread_pools)
+		return Ort::Env(ORT_LOGGING_LEVEL_WARNING, "onnxruntime_server");
+
+	// 0 means ORT default: the number of physical cores for intra-op, 1 for inter-op
+	Ort::ThreadingOptions threading_options;
+	threading_options.SetGlobalIntraOpNumThreads((int)intra_op_threads);
+	threading_options.SetGlobalInterOpNumThreads((int)inter_op_threads);
+	return Ort::Env(threading_options, ORT_LOGGING_LEVEL_WARNING, "onnxruntime_server");
+}
+
+Orts::onnx::environment::environment(bool global_thread_pools, long intra_op_threads, long inter_op_threads)
+	: global_thread_pools(global_thread_pools),
+	  env(create_env(global_thread_pools, intra_op_threads, inter_op_threads)) {
+}
@@ -0,0 +1,111 @@
+#include "../../onnxruntime_server.hpp"
+
+static thread_local Orts::onnx::execution::arena *local_override = nullptr;
+
+Orts::onnx::execution::arena &Orts::onnx::execution::arena::local() {
+	static thread_local arena instance;
+	return local_override != nullptr ? *local_override : instance;
+}
+
+static std::mutex pool_mutex;
+static std::vector<std::unique_ptr<Orts::onnx::execution::arena>> pool;
+
+std::unique_ptr<Orts::onnx::execution::arena, Orts::onnx::execution::arena::recycle>
+Orts::onnx::execution::arena::pooled() {
+	{
+		std::lock_guard<std::mutex> lock(pool_mutex);
+		if (!pool.empty()) {
+			std::unique_ptr<arena, recycle> taken(pool.back().release());
+			pool.pop_back();
+			return taken;
+		}
+	}
+	return std::unique_ptr<arena, recycle>(new arena());
+}
+
+void Orts::onnx::execution::arena::recycle::operator()(arena *target) const {
+	std::unique_ptr<arena> owned(target);
+	owned->reset();
+	std::lock_guard<std::mutex> lock(pool_mutex);
+	if (pool.size() < max_pooled)
+		pool.push_back(std::move(owned));
+}
+
+void *Orts::onnx::execution::arena::allocate(size_t bytes, size_t alignment) {
+	while (true) {
+		for (; current < chunks.size(); current++, offset = 0) {
+			auto &c = chunks[current];
+			auto base = reinterpret_cast<uintptr_t>(c.data.get());
+			auto aligned = (base + offset + alignment - 1) / alignment * alignment - base;
+			if (aligned <= c.size && bytes <= c.size - aligned) {
+				offset = aligned + bytes;
+				return c.data.get() + aligned;
+			}
+		}
+
+		// no chunk has room left. grow geometrically so large requests settle into a few chunks
+		auto size = std::max(chunks.empty() ? initial_chunk_size : chunks.back().size * 2, bytes + alignment);
+		chunks.push_back({std::unique_ptr<char[]>(new char[size]), size});
+		current = chunks.size() - 1;
+		offset = 0;
+	}
+}
+
+void Orts::onnx::execution::arena::deallocate(void *p, size_t bytes) {
+	if (current >= chunks.size())
+		return;
+
+	auto top = chunks[current].data.get() + offset;
+	if (static_cast<char *>(p) + bytes == top)
+		offset -= bytes;
+}
+
+void Orts::onnx::execution::arena::reset() {
+	if (chunks.size() > 1) {
+		// merge into one chunk so the next request of the same size does not have to grow again
+		auto total = capacity();
+		chunks.clear();
+		if (total <= max_retained_size)
+			chunks.push_back({std::unique_ptr<char[]>(new char[total]), total});
+	} else if (!chunks.empty() && chunks.front().size > max_retained_size) {
+		chunks.clear();
+	}
+	current = 0;
+	offset = 0;
+}
+
+size_t Orts::onnx::execution::arena::capacity() const {
+	size_t total = 0;
+	for (auto &c : chunks)
+		total += c.size;
+	return total;
+}
+
+size_t Orts::onnx::execution::arena::used() const {
+	size_t total = offset;
+	for (size_t i = 0; i < current && i < chunks.size(); i++)
+		total += chunks[i].size;
+	return total;
+}
+
+size_t Orts::onnx::execution::arena::active() const {
+	return users;
+}
+
+Orts::onnx::execution::arena::scope::scope(arena &owner) : owner(owner) {
+	owner.users++;
+}
+
+Orts::onnx::execution::arena::scope::~scope() {
+	if (--owner.users == 0)
+		owner.reset();
+}
+
+Orts::onnx::execution::arena::use::use(arena *target) : previous(local_override) {
+	if (target != nullptr)
+		local_override = target;
+}
+
+Orts::onnx::execution::arena::use::~use() {
+	local_override = previous;
+}
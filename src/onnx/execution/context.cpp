@@ -2,23 +2,88 @@
 // Created by Kibae Shin on 2023/09/02.
 //
 
+#include <boost/endian/conversion.hpp>
+#include <cstring>
+#include <limits>
+
 #include "../../onnxruntime_server.hpp"
 
+#define TENSOR_PAYLOAD_ALIGNMENT 8
+
+static size_t tensor_payload_align(size_t offset) {
+	return (offset + TENSOR_PAYLOAD_ALIGNMENT - 1) / TENSOR_PAYLOAD_ALIGNMENT * TENSOR_PAYLOAD_ALIGNMENT;
+}
+
 Orts::onnx::execution::context::context(std::shared_ptr<Orts::onnx::session> session, const json &json_str)
-	: memory_info(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)), session(session) {
+	: own_arena(session->batching() ? arena::pooled() : nullptr),
+	  arena_scope(own_arena != nullptr ? *own_arena : arena::local()),
+	  memory_info(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)), session(session),
+	  inputs(session->inputs().size()) {
 	assert(session != nullptr);
+	arena::use decode_into(own_arena.get());
 
-	json dataset = json_str;
+	if (json_str.is_string()) {
+		auto &str = json_str.get_ref<const json::string_t &>();
+		parse_sax(str.data(), str.size(), json::input_format_t::json, "");
+		return;
+	}
+
+	parse_json(json_str);
+}
 
-	if (!dataset.is_object() && dataset.is_string())
-		dataset = json::parse(dataset.get<std::string>());
+Orts::onnx::execution::context::context(
+	std::shared_ptr<Orts::onnx::session> session, const char *payload, size_t length, payload_format format,
+	const std::string &root
+)
+	: own_arena(session->batching() ? arena::pooled() : nullptr),
+	  arena_scope(own_arena != nullptr ? *own_arena : arena::local()),
+	  memory_info(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)), session(session),
+	  inputs(session->inputs().size()) {
+	assert(session != nullptr);
+	arena::use decode_into(own_arena.get());
+
+	switch (format) {
+	case PAYLOAD_TENSOR:
+		parse_tensor_payload(payload, length);
+		break;
+	case PAYLOAD_MSGPACK:
+		parse_sax(payload, length, json::input_format_t::msgpack, root);
+		break;
+	case PAYLOAD_CBOR:
+		parse_sax(payload, length, json::input_format_t::cbor, root);
+		break;
+	default:
+		parse_sax(payload, length, json::input_format_t::json, root);
+		break;
+	}
+}
+
+void Orts::onnx::execution::context::parse_sax(
+	const char *payload, size_t length, json::input_format_t format, const std::string &root
+) {
+	json_sax_decoder decoder(session->inputs(), root);
+	decoder.parse(payload, length, format);
+	if (!root.empty() && !decoder.root_found)
+		throw bad_request_error(root + " is not object");
+
+	for (size_t i = 0; i < session->inputs().size(); i++) {
+		auto &input = session->inputs()[i];
+		auto decoded = decoder.tensors.find(input.name);
+		if (decoded == decoder.tensors.end())
+			throw bad_request_error("Input " + input.name + " is not array");
 
+		inputs[i].emplace(memory_info, input, std::move(decoded->second));
+	}
+}
+
+void Orts::onnx::execution::context::parse_json(const json &dataset) {
 	// check dataset is object
 	if (!dataset.is_object()) {
 		throw bad_request_error("Top-level JSON dataset is not object");
 	}
 
-	for (auto &input : session->inputs()) {
+	for (size_t i = 0; i < session->inputs().size(); i++) {
+		auto &input = session->inputs()[i];
 		if (!dataset[input.name].is_array())
 			throw bad_request_error("Input " + input.name + " is not array");
 
@@ -26,13 +91,77 @@ Orts::onnx::execution::context::context(std::shared_ptr<Orts::onnx::session> ses
 		std::vector<json::value_type> json_values;
 		flat_json_values(dataset[input.name], &json_values);
 
-		inputs[input.name] = new Orts::onnx::execution::input_value(memory_info, input, json_values);
+		inputs[i].emplace(memory_info, input, json_values);
 	}
 }
 
-Orts::onnx::execution::context::~context() {
-	for (auto &p : inputs) {
-		delete p.second;
+void Orts::onnx::execution::context::parse_tensor_payload(const char *payload, size_t length) {
+	uint32_t header_length;
+	if (length < sizeof(header_length))
+		throw bad_request_error("Invalid tensor payload: too short");
+	std::memcpy(&header_length, payload, sizeof(header_length));
+	boost::endian::little_to_native_inplace(header_length);
+	if (header_length > length - sizeof(header_length))
+		throw bad_request_error("Invalid tensor payload: header length exceeds payload");
+
+	auto header =
+		json::parse(payload + sizeof(header_length), payload + sizeof(header_length) + header_length, nullptr, false);
+	if (header.is_discarded())
+		throw bad_request_error("Invalid tensor payload: header is not valid JSON");
+	if (!header.is_array())
+		throw bad_request_error("Invalid tensor payload: header is not array");
+
+	auto offset = tensor_payload_align(sizeof(header_length) + header_length);
+	for (auto &item : header) {
+		if (!item.is_object() || !item["name"].is_string() || !item["type"].is_string() || !item["shape"].is_array())
+			throw bad_request_error("Invalid tensor payload: header entry must have name, type and shape");
+
+		auto name = item["name"].get<std::string>();
+		auto input = std::find_if(session->inputs().begin(), session->inputs().end(), [&name](const value_info &info) {
+			return info.name == name;
+		});
+		if (input == session->inputs().end())
+			throw bad_request_error("Input " + name + " does not exist");
+		auto &slot = inputs[input - session->inputs().begin()];
+		if (slot.has_value())
+			throw bad_request_error("Input " + name + " is duplicated");
+
+		if (item["type"].get<std::string>() != input->type_name())
+			throw bad_request_error(
+				"Input " + name + " type mismatch: expected " + input->type_name() + ", got " +
+				item["type"].get<std::string>()
+			);
+		if (value_info::element_size(input->element_type) == 0)
+			throw bad_request_error("Input " + name + " type " + input->type_name() + " is not supported in tensor payload");
+
+		if (!std::all_of(item["shape"].begin(), item["shape"].end(), [](const json &dim) {
+				return dim.is_number_integer();
+			}))
+			throw bad_request_error("Input " + name + " shape mismatch: expected " + input->type_to_string());
+		auto shape = item["shape"].get<std::vector<int64_t>>();
+		if (shape.size() != input->shape.size())
+			throw bad_request_error("Input " + name + " shape mismatch: expected " + input->type_to_string());
+		auto element_size = value_info::element_size(input->element_type);
+		size_t count = 1;
+		for (size_t i = 0; i < shape.size(); i++) {
+			if (shape[i] < 0 || (input->shape[i] >= 0 && input->shape[i] != shape[i]))
+				throw bad_request_error("Input " + name + " shape mismatch: expected " + input->type_to_string());
+			if (shape[i] > 0 && count > std::numeric_limits<size_t>::max() / element_size / (size_t)shape[i])
+				throw bad_request_error("Invalid tensor payload: data of input " + name + " exceeds payload");
+			count *= shape[i];
+		}
+
+		auto bytes = count * element_size;
+		if (offset > length || bytes > length - offset)
+			throw bad_request_error("Invalid tensor payload: data of input " + name + " exceeds payload");
+
+		slot.emplace(memory_info, *input, shape, payload + offset, bytes);
+		offset = tensor_payload_align(offset + bytes);
+	}
+
+	for (size_t i = 0; i < session->inputs().size(); i++) {
+		if (!inputs[i].has_value())
+			throw bad_request_error("Input " + session->inputs()[i].name + " is missing");
 	}
 }
 
@@ -48,21 +177,59 @@ void Orts::onnx::execution::context::flat_json_values(
 	}
 }
 
-std::vector<Ort::Value> Orts::onnx::execution::context::run() {
+std::optional<uint64_t> Orts::onnx::execution::context::input_hash() const {
+	uint64_t h = 0;
+	for (auto &input : inputs) {
+		auto info = input->tensors.GetTensorTypeAndShapeInfo();
+		auto type = (int32_t)info.GetElementType();
+		auto shape = info.GetShape();
+		h = result_cache::hash(&type, sizeof(type), h);
+		h = result_cache::hash(shape.data(), shape.size() * sizeof(int64_t), h);
+
+		auto element_size = value_info::element_size(info.GetElementType());
+		if (element_size > 0) {
+			h = result_cache::hash(input->tensors.GetTensorRawData(), info.GetElementCount() * element_size, h);
+			continue;
+		}
+		if (info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)
+			return std::nullopt;
+		// the length goes first so that ["ab", "c"] and ["a", "bc"] differ
+		for (size_t i = 0; i < info.GetElementCount(); i++) {
+			auto element = input->tensors.GetStringTensorElement(i);
+			auto length = (uint64_t)element.size();
+			h = result_cache::hash(&length, sizeof(length), h);
+			h = result_cache::hash(element.data(), element.size(), h);
+		}
+	}
+	return h;
+}
+
+std::vector<Ort::Value> Orts::onnx::execution::context::run(deadline_t deadline) {
 	std::vector<Ort::Value> input_values;
 	input_values.reserve(inputs.size());
 
+	// inputs are already kept in the model's input order, which is how the session runs them
 	for (auto &input : inputs) {
-		input_values.emplace_back(std::move(input.second->tensors));
+		input_values.emplace_back(std::move(input->tensors));
 	}
 
-	return this->session->run(memory_info, input_values);
+	return this->session->run(memory_info, input_values, deadline);
+}
+
+void Orts::onnx::execution::context::run(deadline_t deadline, const batch_scheduler::completion_t &done) {
+	submitted.clear();
+	submitted.reserve(inputs.size());
+	for (auto &input : inputs) {
+		submitted.emplace_back(std::move(input->tensors));
+	}
+
+	this->session->run(memory_info, submitted, deadline, done);
 }
 
 json Orts::onnx::execution::context::tensors_to_json(std::vector<Ort::Value> &tensors) {
 	auto infos = session->outputs();
 	json::object_t output;
-	for (int i = 0; i < tensors.size(); i++) {
+	for (size_t i = 0; i < tensors.size(); i++) {
 		auto &info = infos[i];
 		auto &item = tensors[i];
 
@@ -71,3 +238,65 @@ json Orts::onnx::execution::context::tensors_to_json(std::vector<Ort::Value> &te
 
 	return output;
 }
+
+std::string Orts::onnx::execution::context::tensors_to_json_text(std::vector<Ort::Value> &tensors) {
+	auto infos = session->outputs();
+	std::string output = "{";
+	for (size_t i = 0; i < tensors.size(); i++) {
+		if (i > 0)
+			output += ',';
+		output += json(infos[i].name).dump();
+		output += ':';
+		infos[i].write_tensor_json(tensors[i], output, session->float_precision());
+	}
+	output += '}';
+	return output;
+}
+
+std::string Orts::onnx::execution::context::tensors_to_tensor_payload(std::vector<Ort::Value> &tensors) {
+	auto infos = session->outputs();
+	json::array_t header;
+	std::vector<size_t> sizes;
+	for (size_t i = 0; i < tensors.size(); i++) {
+		auto info = tensors[i].GetTensorTypeAndShapeInfo();
+		auto element_size = value_info::element_size(info.GetElementType());
+		if (element_size == 0)
+			throw bad_request_error(
+				"Output " + infos[i].name + " type " + value_info::type_name(info.GetElementType()) +
+				" is not supported in tensor payload"
+			);
+
+		header.push_back(
+			{{"name", infos[i].name}, {"type", value_info::type_name(info.GetElementType())}, {"shape", info.GetShape()}}
+		);
+		sizes.push_back(info.GetElementCount() * element_size);
+	}
+
+	auto header_str = json(header).dump();
+	auto header_length = boost::endian::native_to_little(static_cast<uint32_t>(header_str.size()));
+
+	auto size = tensor_payload_align(sizeof(header_length) + header_str.size());
+	for (auto &bytes : sizes)
+		size = tensor_payload_align(size + bytes);
+
+	std::string payload(size, '\0');
+	std::memcpy(&payload[0], &header_length, sizeof(header_length));
+	std::memcpy(&payload[sizeof(header_length)], header_str.data(), header_str.size());
+
+	auto offset = tensor_payload_align(sizeof(header_length) + header_str.size());
+	for (size_t i = 0; i < tensors.size(); i++) {
+		std::memcpy(&payload[offset], tensors[i].GetTensorRawData(), sizes[i]);
+		offset = tensor_payload_align(offset + sizes[i]);
+	}
+
+	return payload;
+}
+
+std::string
+Orts::onnx::execution::context::tensors_to_payload(std::vector<Ort::Value> &tensors, payload_format format) {
+	if (format == PAYLOAD_TENSOR)
+		return tensors_to_tensor_payload(tensors);
+	if (format == PAYLOAD_JSON)
+		return tensors_to_json_text(tensors);
+	return encode_payload(tensors_to_json(tensors), format);
+}
@@ -1,23 +1,19 @@
 //
 // Created by Kibae Shin on 2023/09/02.
 //
-#include "../../onnxruntime_server.hpp"
+#include <cstring>
 
-Orts::onnx::execution::input_value::~input_value() {
-	for (auto &p : deallocators) {
-		p();
-	}
-}
+#include "../../onnxruntime_server.hpp"
 
-#define SHAPE_ARG batched_shape(info.shape, values->size()).data(), info.shape.size()
+#define SHAPE_ARG batched_shape(info.shape, json_value.size()).data(), info.shape.size()
 #define ORT_VALUE_RETURN(t)                                                                                            \
 	{                                                                                                                  \
-		auto *values = new std::vector<t>();                                                                           \
+		auto *values = arena::local().allocate<t>(json_value.size());                                                  \
+		size_t count = 0;                                                                                              \
 		for (auto &val : json_value)                                                                                   \
-			values->emplace_back((t)val.get<t>());                                                                     \
+			new (values + count++) t((t)val.get<t>());                                                                 \
                                                                                                                        \
-		tensors = Ort::Value::CreateTensor<t>(memory_info, values->data(), values->size(), SHAPE_ARG);                 \
-		deallocators.emplace_back([values]() { delete values; });                                                      \
+		tensors = Ort::Value::CreateTensor<t>(memory_info, values, count, SHAPE_ARG);                                  \
 		break;                                                                                                         \
 	}
 
@@ -27,18 +23,6 @@ Orts::onnx::execution::input_value::input_value(
 	switch (info.element_type) {
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT: // maps to c type float
 		ORT_VALUE_RETURN(float_t);
-		/*
-		{
-			// for debugging
-			auto *values = new std::vector<float_t>();
-			for (auto &val : json_value)
-				values->emplace_back((float_t)val.get<float_t>());
-
-			tensors = Ort::Value::CreateTensor<float_t>(memory_info, values->data(), values->size(), SHAPE_ARG);
-			deallocators.emplace_back([values]() { delete values; });
-			break;
-		}
-		*/
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE: // maps to c type double
 		ORT_VALUE_RETURN(double_t);
 
@@ -63,53 +47,48 @@ Orts::onnx::execution::input_value::input_value(
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL: //
 	{
 		// Because std::vector<bool> stores in bits to save memory, it doesn't have a .data() method,
-		// so we use std::vector<char>.
-		auto values = new bool[json_value.size()];
+		// so we use a plain bool array.
+		auto values = arena::local().allocate<bool>(json_value.size());
 		for (size_t i = 0; i < json_value.size(); i++)
 			values[i] = json_value[i].get<bool>();
 
-		tensors = Ort::Value::CreateTensor<bool>(
-			memory_info, values, json_value.size(), batched_shape(info.shape, json_value.size()).data(),
-			info.shape.size()
-		);
-		deallocators.emplace_back([values]() { delete[] values; });
+		tensors = Ort::Value::CreateTensor<bool>(memory_info, values, json_value.size(), SHAPE_ARG);
 		break;
 	}
 
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16: // Non-IEEE floating-point format based on IEEE754 single-precision
 	{
-		auto *values = new std::vector<Ort::BFloat16_t>();
+		auto *values = arena::local().allocate<Ort::BFloat16_t>(json_value.size());
+		size_t count = 0;
 		for (auto &val : json_value)
-			values->emplace_back(val.get<float>());
+			new (values + count++) Ort::BFloat16_t(val.get<float>());
 
-		tensors = Ort::Value::CreateTensor<Ort::BFloat16_t>(memory_info, values->data(), values->size(), SHAPE_ARG);
-		deallocators.emplace_back([values]() { delete values; });
+		tensors = Ort::Value::CreateTensor<Ort::BFloat16_t>(memory_info, values, count, SHAPE_ARG);
 		break;
 	}
 
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16: //
 	{
-		auto *values = new std::vector<Ort::Float16_t>();
+		auto *values = arena::local().allocate<Ort::Float16_t>(json_value.size());
+		size_t count = 0;
 		for (auto &val : json_value)
-			values->emplace_back(val.get<float>());
+			new (values + count++) Ort::Float16_t(val.get<float>());
 
-		tensors = Ort::Value::CreateTensor<Ort::Float16_t>(memory_info, values->data(), values->size(), SHAPE_ARG);
-		deallocators.emplace_back([values]() { delete values; });
+		tensors = Ort::Value::CreateTensor<Ort::Float16_t>(memory_info, values, count, SHAPE_ARG);
 		break;
 	}
 
 	case ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING: // maps to c++ type std::string
 	{
-		auto *values = new std::vector<std::string>();
+		strings.reserve(json_value.size());
 		for (auto &val : json_value)
-			values->emplace_back(val.get<std::string>());
+			strings.emplace_back(val.get<std::string>());
 
 		// cannot use Ort::Value::CreateTensor<> generic
 		tensors = Ort::Value::CreateTensor(
-			memory_info, values->data(), values->size() * sizeof(std::string), SHAPE_ARG,
+			memory_info, strings.data(), strings.size() * sizeof(std::string), SHAPE_ARG,
 			ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING
 		);
-		deallocators.emplace_back([values]() { delete values; });
 		break;
 	}
 
@@ -121,6 +100,53 @@ Orts::onnx::execution::input_value::input_value(
 #undef ORT_VALUE_RETURN
 #undef SHAPE_ARG
 
+Orts::onnx::execution::input_value::input_value(
+	const Ort::MemoryInfo &memory_info, const value_info &info, const std::vector<int64_t> &shape, const char *data,
+	size_t length
+) {
+	// wrap the request bytes as-is. copy only when the buffer is not aligned for the element type
+	void *values = const_cast<char *>(data);
+	if (reinterpret_cast<uintptr_t>(data) % value_info::element_size(info.element_type) != 0) {
+		auto *copied = arena::local().allocate(length, alignof(int64_t));
+		std::memcpy(copied, data, length);
+		values = copied;
+	}
+
+	tensors = Ort::Value::CreateTensor(memory_info, values, length, shape.data(), shape.size(), info.element_type);
+}
+
+Orts::onnx::execution::input_value::input_value(
+	const Ort::MemoryInfo &memory_info, const value_info &info, json_sax_decoder::tensor &&decoded
+) {
+	// use the shape given by the array nesting when it fits the model, otherwise treat the values as flat
+	auto shape = decoded.shape;
+	bool fits = !decoded.ragged && shape.size() == info.shape.size();
+	for (size_t i = 0; fits && i < shape.size(); i++) {
+		if (info.shape[i] >= 0 && info.shape[i] != shape[i])
+			fits = false;
+	}
+	if (!fits)
+		shape = batched_shape(info.shape, decoded.count);
+
+	if (info.element_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+		strings = std::move(decoded.strings);
+		// cannot use Ort::Value::CreateTensor<> generic
+		tensors = Ort::Value::CreateTensor(
+			memory_info, strings.data(), strings.size() * sizeof(std::string), shape.data(), shape.size(),
+			ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING
+		);
+		return;
+	}
+
+	if (value_info::element_size(info.element_type) == 0)
+		throw bad_request_error("Not supported type: " + info.type_name());
+
+	// the decoded bytes already live in the arena, so take them over without copying
+	data = std::move(decoded.data);
+	tensors =
+		Ort::Value::CreateTensor(memory_info, data.data(), data.size(), shape.data(), shape.size(), info.element_type);
+}
+
 std::vector<int64_t>
 onnxruntime_server::onnx::execution::input_value::batched_shape(const std::vector<int64_t> &shape, size_t value_count) {
 	// check shape contains -1
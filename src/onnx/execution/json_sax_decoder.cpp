@@ -0,0 +1,313 @@
+#include <cstring>
+
+#include "../../onnxruntime_server.hpp"
+
+Orts::onnx::execution::json_sax_decoder::json_sax_decoder(const std::vector<value_info> &infos, std::string root)
+	: infos(infos), root(std::move(root)), inside_root(this->root.empty()) {
+}
+
+void Orts::onnx::execution::json_sax_decoder::parse(const char *payload, size_t length, json::input_format_t format) {
+	payload_length = length;
+	if (!json::sax_parse(payload, payload + length, this, format))
+		throw bad_request_error(error.empty() ? "Invalid payload" : error);
+}
+
+void Orts::onnx::execution::json_sax_decoder::parse(const char *payload, size_t length, payload_format format) {
+	switch (format) {
+	case PAYLOAD_MSGPACK:
+		return parse(payload, length, json::input_format_t::msgpack);
+	case PAYLOAD_CBOR:
+		return parse(payload, length, json::input_format_t::cbor);
+	case PAYLOAD_JSON:
+		return parse(payload, length, json::input_format_t::json);
+	default:
+		throw bad_request_error("Invalid payload format");
+	}
+}
+
+bool Orts::onnx::execution::json_sax_decoder::fail(const std::string &message) {
+	error = message;
+	return false;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::skip_scalar() {
+	if (skip_depth == 0)
+		skipping = false;
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::outside_root() const {
+	return !inside_root;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::envelope_value(json value) {
+	if (envelope_depth == 0)
+		return fail("Top-level JSON dataset is not object");
+	if (expect_root)
+		return fail(root + " is not object");
+	fields[field] = std::move(value);
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::leaf() {
+	if (depth == 0)
+		return fail("Top-level JSON dataset is not object");
+	if (current == nullptr)
+		return fail("Invalid payload");
+	if (counts.empty())
+		return fail("Input " + current_info->name + " is not array");
+
+	if (current->count == 0)
+		reserve();
+	counts.back()++;
+	current->count++;
+
+	// values must all sit at the same depth for the nesting to describe the shape
+	if (leaf_depth == 0)
+		leaf_depth = counts.size();
+	else if (leaf_depth != counts.size())
+		current->ragged = true;
+	return true;
+}
+
+void Orts::onnx::execution::json_sax_decoder::reserve() {
+	// the arrays opened on the way to the first value announce the shape of a rectangular input. every value takes at
+	// least a byte of the payload, which bounds what a bogus count can make us reserve
+	size_t count = 1;
+	for (auto elements : announced) {
+		if (elements == std::size_t(-1))
+			return;
+		count *= elements;
+		if (count == 0 || count > payload_length)
+			return;
+	}
+	if (current_info->element_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)
+		current->strings.reserve(count);
+	else
+		current->data.reserve(count * value_info::element_size(current_info->element_type));
+}
+
+template <typename T> bool Orts::onnx::execution::json_sax_decoder::append(T value) {
+	auto bytes = reinterpret_cast<const char *>(&value);
+	current->data.insert(current->data.end(), bytes, bytes + sizeof(T));
+	return true;
+}
+
+template <typename T> bool Orts::onnx::execution::json_sax_decoder::number(T value) {
+	if (skipping)
+		return skip_scalar();
+	if (outside_root())
+		return envelope_value(json(value));
+	if (!leaf())
+		return false;
+
+	switch (current_info->element_type) {
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+		return append(static_cast<float>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+		return append(static_cast<double>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+		return append(static_cast<int8_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+		return append(static_cast<int16_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+		return append(static_cast<int32_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+		return append(static_cast<int64_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+		return append(static_cast<uint8_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+		return append(static_cast<uint16_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+		return append(static_cast<uint32_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+		return append(static_cast<uint64_t>(value));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+		return append(Ort::Float16_t(static_cast<float>(value)));
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+		return append(Ort::BFloat16_t(static_cast<float>(value)));
+	default:
+		return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+	}
+}
+
+bool Orts::onnx::execution::json_sax_decoder::null() {
+	if (skipping)
+		return skip_scalar();
+	if (outside_root())
+		return envelope_value(json(nullptr));
+	if (!leaf())
+		return false;
+	return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+}
+
+bool Orts::onnx::execution::json_sax_decoder::boolean(bool val) {
+	if (skipping)
+		return skip_scalar();
+	if (outside_root())
+		return envelope_value(json(val));
+	if (!leaf())
+		return false;
+	if (current_info->element_type != ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL)
+		return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+	return append(val);
+}
+
+bool Orts::onnx::execution::json_sax_decoder::number_integer(json::number_integer_t val) {
+	return number(val);
+}
+
+bool Orts::onnx::execution::json_sax_decoder::number_unsigned(json::number_unsigned_t val) {
+	return number(val);
+}
+
+bool Orts::onnx::execution::json_sax_decoder::number_float(json::number_float_t val, const json::string_t & /*s*/) {
+	return number(val);
+}
+
+bool Orts::onnx::execution::json_sax_decoder::string(json::string_t &val) {
+	if (skipping)
+		return skip_scalar();
+	if (outside_root())
+		return envelope_value(json(std::move(val)));
+	if (!leaf())
+		return false;
+	if (current_info->element_type != ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)
+		return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+	current->strings.emplace_back(std::move(val));
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::binary(json::binary_t &val) {
+	if (skipping)
+		return skip_scalar();
+	if (outside_root())
+		return envelope_value(json::binary(std::move(val)));
+	if (!leaf())
+		return false;
+	return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+}
+
+bool Orts::onnx::execution::json_sax_decoder::start_object(std::size_t /*elements*/) {
+	if (skipping) {
+		skip_depth++;
+		return true;
+	}
+	if (outside_root()) {
+		if (envelope_depth == 0) {
+			envelope_depth++;
+			return true;
+		}
+		if (!expect_root) {
+			skipping = true;
+			skip_depth = 1;
+			return true;
+		}
+		expect_root = false;
+		inside_root = true;
+		root_found = true;
+	}
+	if (depth == 0) {
+		depth++;
+		return true;
+	}
+	return fail("Input " + current_info->name + " has invalid value. expected " + current_info->type_name());
+}
+
+bool Orts::onnx::execution::json_sax_decoder::key(json::string_t &val) {
+	if (skipping)
+		return true;
+	if (outside_root()) {
+		expect_root = val == root;
+		field = val;
+		return true;
+	}
+
+	auto info = std::find_if(infos.begin(), infos.end(), [&val](const value_info &info) { return info.name == val; });
+	if (info == infos.end()) {
+		skipping = true;
+		skip_depth = 0;
+		return true;
+	}
+
+	current_info = &*info;
+	current = &(tensors[val] = tensor());
+	counts.clear();
+	announced.clear();
+	leaf_depth = 0;
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::end_object() {
+	if (skipping) {
+		if (--skip_depth == 0)
+			skipping = false;
+		return true;
+	}
+	if (outside_root()) {
+		envelope_depth--;
+		return true;
+	}
+	depth--;
+	// back in the envelope once the root object closes
+	if (depth == 0 && !root.empty())
+		inside_root = false;
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::start_array(std::size_t elements) {
+	if (skipping) {
+		skip_depth++;
+		return true;
+	}
+	if (outside_root()) {
+		if (envelope_depth == 0 || expect_root)
+			return envelope_value(json());
+		skipping = true;
+		skip_depth = 1;
+		return true;
+	}
+	if (depth == 0)
+		return fail("Top-level JSON dataset is not object");
+
+	if (!counts.empty())
+		counts.back()++;
+	counts.push_back(0);
+	announced.push_back(elements);
+	depth++;
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::end_array() {
+	if (skipping) {
+		if (--skip_depth == 0)
+			skipping = false;
+		return true;
+	}
+
+	auto level = counts.size() - 1;
+	auto count = counts.back();
+	counts.pop_back();
+	announced.pop_back();
+	depth--;
+
+	auto &shape = current->shape;
+	if (shape.size() <= level)
+		shape.resize(level + 1, -1);
+	if (shape[level] < 0)
+		shape[level] = count;
+	else if (shape[level] != count)
+		current->ragged = true;
+
+	if (counts.empty()) {
+		current = nullptr;
+		current_info = nullptr;
+	}
+	return true;
+}
+
+bool Orts::onnx::execution::json_sax_decoder::parse_error(
+	std::size_t /*position*/, const std::string & /*last_token*/, const json::exception &ex
+) {
+	return fail(ex.what());
+}
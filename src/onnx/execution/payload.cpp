@@ -0,0 +1,31 @@
+#include "../../onnxruntime_server.hpp"
+
+json Orts::onnx::execution::decode_payload(const char *payload, size_t length, payload_format format) {
+	switch (format) {
+	case PAYLOAD_JSON:
+		return json::parse(payload, payload + length);
+	case PAYLOAD_MSGPACK:
+		return json::from_msgpack(payload, payload + length);
+	case PAYLOAD_CBOR:
+		return json::from_cbor(payload, payload + length);
+	default:
+		throw bad_request_error("Tensor payload is only supported for execute session");
+	}
+}
+
+std::string Orts::onnx::execution::encode_payload(const json &value, payload_format format) {
+	std::string result;
+	switch (format) {
+	case PAYLOAD_MSGPACK:
+		json::to_msgpack(value, result);
+		break;
+	case PAYLOAD_CBOR:
+		json::to_cbor(value, result);
+		break;
+	default:
+		// tensor payloads only carry tensors, other responses fall back to JSON
+		result = value.dump();
+		break;
+	}
+	return result;
+}
@@ -0,0 +1,51 @@
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "../onnxruntime_server.hpp"
+
+namespace bip = boost::interprocess;
+
+Orts::onnx::model_bin::model_bin(std::string bin) {
+	auto owned = std::make_shared<const std::string>(std::move(bin));
+	data = owned->data();
+	length = owned->size();
+	holder = std::move(owned);
+}
+
+bool Orts::onnx::model_bin::has_data() const {
+	return data != nullptr && length > 0;
+}
+
+Orts::onnx::model_bin Orts::onnx::model_bin::from_path(std::string path) {
+	model_bin bin;
+	bin.path = std::move(path);
+	return bin;
+}
+
+Orts::onnx::model_bin Orts::onnx::model_bin::map_file(const std::string &path) {
+	struct mapped_file {
+		bip::file_mapping file;
+		bip::mapped_region region;
+	};
+
+	std::shared_ptr<mapped_file> mapped;
+	try {
+		mapped = std::make_shared<mapped_file>();
+		mapped->file = bip::file_mapping(path.c_str(), bip::read_only);
+		mapped->region = bip::mapped_region(mapped->file, bip::read_only);
+	} catch (bip::interprocess_exception &e) {
+		throw runtime_error("Cannot map model file: " + path + " (" + e.what() + ")");
+	}
+	if (mapped->region.get_size() == 0)
+		throw runtime_error("Model file is empty: " + path);
+
+	// ONNX Runtime parses the model front to back once
+	mapped->region.advise(bip::mapped_region::advice_sequential);
+
+	model_bin bin;
+	bin.path = path;
+	bin.data = static_cast<const char *>(mapped->region.get_address());
+	bin.length = mapped->region.get_size();
+	bin.holder = std::move(mapped);
+	return bin;
+}
@@ -0,0 +1,149 @@
+#include <cstring>
+
+#include "../onnxruntime_server.hpp"
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+// bookkeeping of an entry besides its value: list node, index slot and allocator headers
+#define RESULT_CACHE_ENTRY_OVERHEAD 96
+
+static inline uint64_t xxh_rotl(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t xxh_read64(const unsigned char *p) {
+	uint64_t v;
+	std::memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline uint32_t xxh_read32(const unsigned char *p) {
+	uint32_t v;
+	std::memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+	acc += input * XXH_PRIME64_2;
+	acc = xxh_rotl(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxh_merge_round(uint64_t acc, uint64_t val) {
+	acc ^= xxh_round(0, val);
+	return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t Orts::onnx::result_cache::hash(const void *data, size_t length, uint64_t seed) {
+	auto p = static_cast<const unsigned char *>(data);
+	auto end = p + length;
+	uint64_t h;
+
+	if (length >= 32) {
+		uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+		uint64_t v2 = seed + XXH_PRIME64_2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - XXH_PRIME64_1;
+		for (; p + 32 <= end; p += 32) {
+			v1 = xxh_round(v1, xxh_read64(p));
+			v2 = xxh_round(v2, xxh_read64(p + 8));
+			v3 = xxh_round(v3, xxh_read64(p + 16));
+			v4 = xxh_round(v4, xxh_read64(p + 24));
+		}
+		h = xxh_rotl(v1, 1) + xxh_rotl(v2, 7) + xxh_rotl(v3, 12) + xxh_rotl(v4, 18);
+		h = xxh_merge_round(h, v1);
+		h = xxh_merge_round(h, v2);
+		h = xxh_merge_round(h, v3);
+		h = xxh_merge_round(h, v4);
+	} else {
+		h = seed + XXH_PRIME64_5;
+	}
+	h += length;
+
+	for (; p + 8 <= end; p += 8) {
+		h ^= xxh_round(0, xxh_read64(p));
+		h = xxh_rotl(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+	}
+	if (p + 4 <= end) {
+		h ^= (uint64_t)xxh_read32(p) * XXH_PRIME64_1;
+		h = xxh_rotl(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		p += 4;
+	}
+	for (; p < end; p++) {
+		h ^= (*p) * XXH_PRIME64_5;
+		h = xxh_rotl(h, 11) * XXH_PRIME64_1;
+	}
+
+	h ^= h >> 33;
+	h *= XXH_PRIME64_2;
+	h ^= h >> 29;
+	h *= XXH_PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
+
+Orts::onnx::result_cache::result_cache(size_t max_bytes, long ttl_ms) : max_bytes(max_bytes), ttl(ttl_ms) {
+}
+
+std::optional<std::string> Orts::onnx::result_cache::get(uint64_t key) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = index.find(key);
+	if (it == index.end()) {
+		misses++;
+		return std::nullopt;
+	}
+	if (ttl.count() > 0 && std::chrono::steady_clock::now() - it->second->stored_at >= ttl) {
+		erase(it->second);
+		misses++;
+		return std::nullopt;
+	}
+
+	entries.splice(entries.begin(), entries, it->second);
+	hits++;
+	return it->second->value;
+}
+
+void Orts::onnx::result_cache::put(uint64_t key, std::string value) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto found = index.find(key);
+	if (found != index.end())
+		erase(found->second);
+
+	entry e{key, std::move(value), std::chrono::steady_clock::now()};
+	auto size = entry_bytes(e);
+	if (size > max_bytes)
+		return;
+
+	while (!entries.empty() && bytes + size > max_bytes) {
+		erase(std::prev(entries.end()));
+		evictions++;
+	}
+	entries.push_front(std::move(e));
+	index[key] = entries.begin();
+	bytes += size;
+}
+
+json Orts::onnx::result_cache::to_json() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	json::object_t dict;
+	dict["hits"] = hits;
+	dict["misses"] = misses;
+	dict["evictions"] = evictions;
+	dict["entries"] = entries.size();
+	dict["bytes"] = bytes;
+	return dict;
+}
+
+size_t Orts::onnx::result_cache::entry_bytes(const entry &e) {
+	return e.value.size() + RESULT_CACHE_ENTRY_OVERHEAD;
+}
+
+void Orts::onnx::result_cache::erase(std::list<entry>::iterator it) {
+	bytes -= entry_bytes(*it);
+	index.erase(it->key);
+	entries.erase(it);
+}
@@ -0,0 +1,66 @@
+#include "../onnxruntime_server.hpp"
+
+Orts::onnx::run_watchdog::~run_watchdog() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	condition.notify_all();
+	if (worker.joinable())
+		worker.join();
+}
+
+void Orts::onnx::run_watchdog::loop() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (!stop) {
+		if (runs.empty()) {
+			condition.wait(lock);
+			continue;
+		}
+
+		auto first = runs.begin();
+		if (first->first <= std::chrono::steady_clock::now()) {
+			// ORT checks the flag between kernels and fails the run
+			first->second->SetTerminate();
+			runs.erase(first);
+			continue;
+		}
+		condition.wait_until(lock, first->first);
+	}
+}
+
+bool Orts::onnx::run_watchdog::expired(deadline_t deadline) {
+	return deadline != deadline_t::max() && std::chrono::steady_clock::now() >= deadline;
+}
+
+Orts::onnx::run_watchdog::guard::guard(run_watchdog &owner, Ort::RunOptions &options, deadline_t deadline)
+	: owner(owner), deadline(deadline) {
+	if (deadline == deadline_t::max())
+		return;
+
+	this->options = &options;
+	bool earliest;
+	{
+		std::lock_guard<std::mutex> lock(owner.mutex);
+		if (!owner.worker.joinable())
+			owner.worker = std::thread([&owner] { owner.loop(); });
+		earliest = owner.runs.emplace(deadline, &options) == owner.runs.begin();
+	}
+	if (earliest)
+		owner.condition.notify_one();
+}
+
+Orts::onnx::run_watchdog::guard::~guard() {
+	if (options == nullptr)
+		return;
+
+	// the entry is already gone if the watchdog fired
+	std::lock_guard<std::mutex> lock(owner.mutex);
+	auto range = owner.runs.equal_range(deadline);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second == options) {
+			owner.runs.erase(it);
+			break;
+		}
+	}
+}
@@ -2,6 +2,9 @@
 // Created by Kibae Shin on 2023/09/01.
 //
 
+#include <filesystem>
+#include <fstream>
+#include <set>
 #include <utility>
 
 #include "../onnxruntime_server.hpp"
@@ -10,8 +13,36 @@
 #include "cuda/session_options.hpp"
 #endif
 
-Orts::onnx::session::session(session_key key, const json &option)
-	: key(std::move(key)), created_at(std::chrono::system_clock::now()), allocator(), session_options() {
+Orts::onnx::session::session(session_key key, const json &option, std::shared_ptr<environment> env)
+	: env(env != nullptr ? std::move(env) : std::make_shared<environment>()), key(std::move(key)),
+	  created_at(std::chrono::system_clock::now()), allocator(), session_options() {
+	// numa_node: weights are first touched and intra-op threads run on the CPUs of one node
+	if (option.contains("numa_node")) {
+		if (!option["numa_node"].is_number_integer() ||
+			cpu_topology::host().node_cpus(option["numa_node"].get<int>()).empty())
+			throw bad_request_error("Invalid numa_node option: no such NUMA node " + option["numa_node"].dump());
+		_numa_node = option["numa_node"].get<int>();
+	}
+	_option["numa_node"] = _numa_node >= 0 ? json(_numa_node) : json(nullptr);
+
+	// run on the process-wide thread pools of the environment unless the session opts out or sizes its own pools
+	auto pin_replicas = option.contains("pin_replicas") && option["pin_replicas"] == true;
+	auto per_session_threads = option.contains("intra_op_num_threads") || option.contains("inter_op_num_threads") ||
+							   pin_replicas || _numa_node >= 0;
+	auto global_thread_pool = !option.contains("global_thread_pool") || !option["global_thread_pool"].is_boolean() ||
+							  option["global_thread_pool"].get<bool>();
+	if (per_session_threads && option.contains("global_thread_pool") && option["global_thread_pool"] == true)
+		throw bad_request_error("intra_op_num_threads, inter_op_num_threads, pin_replicas and numa_node cannot be used "
+								"with global_thread_pool");
+
+	_option["global_thread_pool"] = false;
+	if (this->env->global_thread_pools && global_thread_pool && !per_session_threads) {
+		session_options.DisablePerSessionThreads();
+		_option["global_thread_pool"] = true;
+	}
+
+	init_session_options(option);
+
 	_option["cuda"] = false;
 
 	if (option.contains("cuda") && (!option["cuda"].is_boolean() || option["cuda"].get<bool>())) {
@@ -21,29 +52,390 @@ Orts::onnx::session::session(session_key key, const json &option)
 		throw runtime_error("CUDA is not supported");
 #endif
 	}
+
+	// dynamic batching: true or {"max_batch_size": 32, "max_queue_delay_us": 1000}
+	_option["batching"] = false;
+	if (option.contains("batching") && (!option["batching"].is_boolean() || option["batching"].get<bool>())) {
+		auto batching = option["batching"];
+		json result = json::object();
+		result["max_batch_size"] =
+			batching.is_object() && batching.contains("max_batch_size") ? batching["max_batch_size"] : json(32);
+		result["max_queue_delay_us"] = batching.is_object() && batching.contains("max_queue_delay_us")
+										   ? batching["max_queue_delay_us"]
+										   : json(1000);
+		if (!result["max_batch_size"].is_number_integer() || !result["max_queue_delay_us"].is_number_integer() ||
+			result["max_batch_size"].get<int64_t>() < 1 || result["max_queue_delay_us"].get<long>() < 0)
+			throw bad_request_error("Invalid batching option: " + batching.dump());
+		_option["batching"] = result;
+	}
+
+	// result cache: true or {"max_bytes": 67108864, "ttl_ms": 0}. identical inputs are answered without running
+	_option["result_cache"] = false;
+	if (option.contains("result_cache") &&
+		(!option["result_cache"].is_boolean() || option["result_cache"].get<bool>())) {
+		auto cache = option["result_cache"];
+		if (!cache.is_boolean() && !cache.is_object())
+			throw bad_request_error("Invalid result_cache option: " + cache.dump());
+		json result = json::object();
+		result["max_bytes"] = cache.is_object() && cache.contains("max_bytes") ? cache["max_bytes"] : json(64 << 20);
+		result["ttl_ms"] = cache.is_object() && cache.contains("ttl_ms") ? cache["ttl_ms"] : json(0);
+		if (!result["max_bytes"].is_number_integer() || result["max_bytes"].get<int64_t>() < 1 ||
+			!result["ttl_ms"].is_number_integer() || result["ttl_ms"].get<long>() < 0)
+			throw bad_request_error("Invalid result_cache option: " + cache.dump());
+		_option["result_cache"] = result;
+		_result_cache = std::make_unique<result_cache>(
+			(size_t)result["max_bytes"].get<int64_t>(), result["ttl_ms"].get<long>()
+		);
+	}
+
+	if (option.contains("float_precision")) {
+		if (!option["float_precision"].is_number_integer() || option["float_precision"].get<int>() < 0 ||
+			option["float_precision"].get<int>() > 17)
+			throw bad_request_error("Invalid float_precision option: " + option["float_precision"].dump());
+		_float_precision = option["float_precision"].get<int>();
+	}
+	_option["float_precision"] = _float_precision;
+
+	// requests that take longer, counted from their arrival, are dropped or terminated with 504
+	if (option.contains("timeout_ms")) {
+		if (!option["timeout_ms"].is_number_integer() || option["timeout_ms"].get<long>() < 0)
+			throw bad_request_error("Invalid timeout_ms option: " + option["timeout_ms"].dump());
+		_timeout_ms = option["timeout_ms"].get<long>();
+	}
+	_option["timeout_ms"] = _timeout_ms;
+
+	// lane of the worker queue. higher lanes are served first, starved requests of lower lanes still get through
+	if (option.contains("priority")) {
+		if (!option["priority"].is_string())
+			throw bad_request_error("Invalid priority option: " + option["priority"].dump());
+		_priority = builtin_thread_pool::parse_priority(option["priority"].get<std::string>());
+	}
+	_option["priority"] = builtin_thread_pool::priority_name(_priority);
+
+	// replicas: independent ORT sessions of the same model. each run goes to the replica with the fewest runs in flight
+	_option["replicas"] = 1;
+	if (option.contains("replicas")) {
+		if (!option["replicas"].is_number_integer() || option["replicas"].get<long>() < 1)
+			throw bad_request_error("Invalid replicas option: " + option["replicas"].dump());
+		_option["replicas"] = option["replicas"].get<long>();
+	}
+	// IoBinding reuses the output tensors of previous runs with the same input shapes. opt-in, since every thread that
+	// runs the session keeps up to 8 output sets alive
+	if (option.contains("io_binding") && !option["io_binding"].is_boolean())
+		throw bad_request_error("Invalid session option: io_binding must be boolean");
+	_option["io_binding"] = option.contains("io_binding") && option["io_binding"].get<bool>();
+	if (option.contains("pin_replicas") && !option["pin_replicas"].is_boolean())
+		throw bad_request_error("Invalid session option: pin_replicas must be boolean");
+	_option["pin_replicas"] = pin_replicas;
+}
+
+void Orts::onnx::session::init_session_options(const json &option) {
+	static const std::map<std::string, GraphOptimizationLevel> graph_optimization_levels = {
+		{"disable", ORT_DISABLE_ALL},
+		{"basic", ORT_ENABLE_BASIC},
+		{"extended", ORT_ENABLE_EXTENDED},
+		{"all", ORT_ENABLE_ALL},
+	};
+	static const std::map<std::string, ExecutionMode> execution_modes = {
+		{"sequential", ORT_SEQUENTIAL},
+		{"parallel", ORT_PARALLEL},
+	};
+
+	auto get_bool = [&option](const std::string &name, bool default_value) {
+		if (!option.contains(name))
+			return default_value;
+		if (!option[name].is_boolean())
+			throw bad_request_error("Invalid session option: " + name + " must be boolean");
+		return option[name].get<bool>();
+	};
+	auto get_threads = [&option](const std::string &name) {
+		if (!option.contains(name))
+			return 0L;
+		if (!option[name].is_number_integer() || option[name].get<long>() < 0)
+			throw bad_request_error("Invalid session option: " + name + " must be a non-negative integer");
+		return option[name].get<long>();
+	};
+	auto get_enum = [&option](const std::string &name, const auto &values, const std::string &default_value) {
+		if (!option.contains(name))
+			return default_value;
+		if (!option[name].is_string() || values.find(option[name].get<std::string>()) == values.end())
+			throw bad_request_error("Invalid session option: " + name + "=" + option[name].dump());
+		return option[name].get<std::string>();
+	};
+
+	// 0 means ONNX Runtime default
+	auto intra_op_num_threads = get_threads("intra_op_num_threads");
+	auto inter_op_num_threads = get_threads("inter_op_num_threads");
+	session_options.SetIntraOpNumThreads((int)intra_op_num_threads);
+	session_options.SetInterOpNumThreads((int)inter_op_num_threads);
+	_option["intra_op_num_threads"] = intra_op_num_threads;
+	_option["inter_op_num_threads"] = inter_op_num_threads;
+
+	auto execution_mode = get_enum("execution_mode", execution_modes, "sequential");
+	session_options.SetExecutionMode(execution_modes.at(execution_mode));
+	_option["execution_mode"] = execution_mode;
+
+	auto graph_optimization_level = get_enum("graph_optimization_level", graph_optimization_levels, "all");
+	session_options.SetGraphOptimizationLevel(graph_optimization_levels.at(graph_optimization_level));
+	_option["graph_optimization_level"] = graph_optimization_level;
+
+	auto enable_cpu_mem_arena = get_bool("enable_cpu_mem_arena", true);
+	if (enable_cpu_mem_arena)
+		session_options.EnableCpuMemArena();
+	else
+		session_options.DisableCpuMemArena();
+	_option["enable_cpu_mem_arena"] = enable_cpu_mem_arena;
+
+	auto enable_mem_pattern = get_bool("enable_mem_pattern", true);
+	if (enable_mem_pattern)
+		session_options.EnableMemPattern();
+	else
+		session_options.DisableMemPattern();
+	_option["enable_mem_pattern"] = enable_mem_pattern;
+
+	// spin-wait of idle intra/inter-op threads. turning it off trades latency for CPU usage.
+	// sessions on the global thread pools follow the spin control of the environment instead.
+	auto allow_spinning = get_bool("allow_spinning", true);
+	session_options.AddConfigEntry("session.intra_op.allow_spinning", allow_spinning ? "1" : "0");
+	session_options.AddConfigEntry("session.inter_op.allow_spinning", allow_spinning ? "1" : "0");
+	_option["allow_spinning"] = allow_spinning;
+
+	// prepacked weights are shared with the other sessions of the environment. see create_ort_session
+	_option["share_weights"] = get_bool("share_weights", false);
 }
 
-Orts::onnx::session::session(session_key key, const std::string &path, const json &option) : session(std::move(key), option) {
+static std::basic_string<ORTCHAR_T> to_ort_path(const std::string &path) {
 #ifdef _WIN32
 	int size_needed = MultiByteToWideChar(CP_ACP, 0, path.c_str(), -1, NULL, 0);
 	std::wstring wstr(size_needed, 0);
 	MultiByteToWideChar(CP_ACP, 0, path.c_str(), -1, &wstr[0], size_needed);
-
-	auto model_path = wstr.c_str();
+	wstr.resize(wcslen(wstr.c_str()));
+	return wstr;
 #else
-	auto model_path = path.c_str();
+	return path;
 #endif
+}
 
-	ort_session = new Ort::Session(env, model_path, session_options);
+Orts::onnx::session::session(
+	session_key key, const std::string &path, const json &option, std::shared_ptr<environment> env
+)
+	: session(std::move(key), option, std::move(env)) {
+	create_replicas([this, &path](const Ort::SessionOptions &options) { return create_ort_session(path, options); });
 	init();
 }
 
-Orts::onnx::session::session(session_key key, const char *model_data, size_t model_data_length, const json &option)
-	: session(std::move(key), option) {
-	ort_session = new Ort::Session(env, model_data, model_data_length, session_options);
+Orts::onnx::session::session(
+	session_key key, const char *model_data, size_t model_data_length, const json &option,
+	std::shared_ptr<environment> env
+)
+	: session(std::move(key), option, std::move(env)) {
+	create_replicas([this, model_data, model_data_length](const Ort::SessionOptions &options) {
+		return create_ort_session(model_data, model_data_length, options);
+	});
 	init();
 }
 
+Orts::onnx::session::session(
+	session_key key, const model_bin &bin, const json &option, std::shared_ptr<environment> env,
+	const std::string &optimized_model_cache_dir
+)
+	: session(std::move(key), option, std::move(env)) {
+	auto create = [this, &bin](const Ort::SessionOptions &options) {
+		if (bin.has_data())
+			return create_ort_session(bin.data, bin.length, options);
+		return create_ort_session(bin.path, options);
+	};
+
+	if (optimized_model_cache_dir.empty()) {
+		create_replicas(create);
+		init();
+		return;
+	}
+
+	auto cache_path = optimized_model_cache_path(bin, optimized_model_cache_dir);
+	if (std::filesystem::exists(cache_path)) {
+		try {
+			// the cached graph is already optimized for this ORT version and these options
+			create_replicas([this, &cache_path](const Ort::SessionOptions &options) {
+				Ort::SessionOptions cached_options = options.Clone();
+				cached_options.SetGraphOptimizationLevel(ORT_DISABLE_ALL);
+				return create_ort_session(cache_path, cached_options);
+			});
+			_option["optimized_model_cache"] = "hit";
+			init();
+			return;
+		} catch (Ort::Exception &e) {
+			PLOG(L_WARNING) << "Ignoring broken optimized model cache " << cache_path << ": " << e.what() << std::endl;
+			replicas.clear();
+			std::error_code ec;
+			std::filesystem::remove(cache_path, ec);
+		}
+	}
+
+	// write to a temporary file first so that a concurrent or interrupted load never leaves a partial cache entry
+	auto temp_path =
+		cache_path + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+	std::error_code ec;
+	std::filesystem::create_directories(optimized_model_cache_dir, ec);
+	session_options.SetOptimizedModelFilePath(to_ort_path(temp_path).c_str());
+	if (_option["cuda"] == false)
+		session_options.AddConfigEntry("session.save_model_format", "ORT");
+	try {
+		create_replicas(create);
+		std::filesystem::rename(temp_path, cache_path, ec);
+		_option["optimized_model_cache"] = ec ? "error" : "saved";
+	} catch (Ort::Exception &e) {
+		// e.g. models over 2GB cannot be serialized without external initializers. load without the cache
+		PLOG(L_WARNING) << "Cannot write optimized model cache " << cache_path << ": " << e.what() << std::endl;
+		replicas.clear();
+		session_options.SetOptimizedModelFilePath(ORT_TSTR(""));
+		create_replicas(create);
+		_option["optimized_model_cache"] = "error";
+	}
+	std::filesystem::remove(temp_path, ec);
+	init();
+}
+
+void Orts::onnx::session::create_replicas(const std::function<Ort::Session *(const Ort::SessionOptions &)> &create) {
+	// Linux places pages on the node of the thread that touches them first, so the weights land on the session's node
+	std::optional<cpu_topology::pin_scope> pinned;
+	if (_numa_node >= 0)
+		pinned.emplace(cpu_topology::host().node_cpus(_numa_node));
+
+	auto count = _option["replicas"].get<long>();
+	for (long i = 0; i < count; i++) {
+		auto options = replica_options(i);
+		replicas.emplace_back(std::make_unique<replica>(create(options)));
+	}
+	// metadata and IO names are read from the first replica; every replica runs the same graph
+	ort_session = replicas.front()->ort_session;
+}
+
+Ort::SessionOptions Orts::onnx::session::replica_options(long index) {
+	auto options = session_options.Clone();
+	// only the first replica writes the optimized model
+	if (index > 0)
+		options.SetOptimizedModelFilePath(ORT_TSTR(""));
+
+	if (_option["pin_replicas"] != true && _numa_node < 0)
+		return options;
+
+	std::vector<int> cpus = _numa_node >= 0 ? cpu_topology::host().node_cpus(_numa_node) : std::vector<int>();
+	if (cpus.empty()) {
+		for (int cpu = 0; cpu < (int)std::max(1U, std::thread::hardware_concurrency()); cpu++)
+			cpus.push_back(cpu);
+	}
+	auto [threads, affinities] = intra_op_affinities(
+		cpus, _option["pin_replicas"] == true, _option["replicas"].get<long>(), index,
+		_option["intra_op_num_threads"].get<long>()
+	);
+	options.SetIntraOpNumThreads((int)threads);
+	if (!affinities.empty())
+		options.AddConfigEntry("session.intra_op_thread_affinities", affinities.c_str());
+	return options;
+}
+
+std::pair<long, std::string> Orts::onnx::session::intra_op_affinities(
+	const std::vector<int> &cpus, bool pin_replicas, long replicas, long index, long intra_op_threads
+) {
+	long cores = (long)cpus.size();
+	// logical processor ids are 1-based
+	auto ort_cpu = [&cpus](long i) { return std::to_string(cpus[i % cpus.size()] + 1); };
+
+	std::string affinities;
+	if (pin_replicas) {
+		// split the cores evenly. the calling thread joins the intra-op work, so it takes no pool thread of its own
+		auto per_replica = std::max(1L, cores / replicas);
+		auto first = index * per_replica;
+		for (long t = 1; t < per_replica; t++) {
+			if (!affinities.empty())
+				affinities += ";";
+			affinities += ort_cpu(first + t);
+		}
+		return {per_replica, affinities};
+	}
+
+	// every intra-op thread may run on any core of the node
+	auto threads = intra_op_threads > 0 ? intra_op_threads : cores;
+	std::string node_cpus;
+	for (long c = 0; c < cores; c++)
+		node_cpus += (c > 0 ? "," : "") + ort_cpu(c);
+	for (long t = 1; t < threads; t++) {
+		if (!affinities.empty())
+			affinities += ";";
+		affinities += node_cpus;
+	}
+	return {threads, affinities};
+}
+
+Ort::Session *Orts::onnx::session::create_ort_session(const std::string &path, const Ort::SessionOptions &options) {
+	if (_option["share_weights"] == true)
+		return new Ort::Session(env->env, to_ort_path(path).c_str(), options, env->prepacked_weights);
+	return new Ort::Session(env->env, to_ort_path(path).c_str(), options);
+}
+
+Ort::Session *Orts::onnx::session::create_ort_session(
+	const char *model_data, size_t model_data_length, const Ort::SessionOptions &options
+) {
+	if (_option["share_weights"] == true)
+		return new Ort::Session(env->env, model_data, model_data_length, options, env->prepacked_weights);
+	return new Ort::Session(env->env, model_data, model_data_length, options);
+}
+
+// identifies the CPU model and its instruction set, which decide the kernels and layouts the optimizer picks. read once
+// from the first processor of /proc/cpuinfo, leaving out fields that change while running such as the clock
+static const std::string &host_cpu_id() {
+	static const std::string id = []() {
+		static const std::set<std::string> keys = {
+			"vendor_id", "cpu family", "model", "model name", "flags", "CPU implementer", "CPU architecture",
+			"CPU variant", "CPU part", "Features",
+		};
+		std::string result;
+		std::ifstream cpuinfo("/proc/cpuinfo");
+		std::string line;
+		while (std::getline(cpuinfo, line) && !line.empty()) {
+			auto colon = line.find(':');
+			if (colon == std::string::npos)
+				continue;
+			auto name = line.substr(0, line.find_last_not_of(" \t", colon - 1) + 1);
+			if (keys.count(name) > 0)
+				result += line + "\n";
+		}
+		return result;
+	}();
+	return id;
+}
+
+std::string
+Orts::onnx::session::optimized_model_cache_path(const model_bin &bin, const std::string &optimized_model_cache_dir) const {
+	// the model bytes, the ONNX Runtime version, the optimization level and the hardware it was optimized for determine
+	// the optimized graph. options that only affect how it runs do not
+	model_bin mapped;
+	auto data = &bin;
+	if (!bin.has_data()) {
+		mapped = model_bin::map_file(bin.path);
+		data = &mapped;
+	}
+
+	json graph_options = {
+		{"ort_version", version()},
+		{"graph_optimization_level", _option["graph_optimization_level"]},
+		{"execution_provider", _option["cuda"] == false ? "CPUExecutionProvider" : "CUDAExecutionProvider"},
+		{"cpu", host_cpu_id()},
+	};
+	auto options = graph_options.dump();
+	auto hash = result_cache::hash(data->data, data->length);
+	hash = result_cache::hash(options.data(), options.size(), hash);
+
+	char hex[17];
+	snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+
+	auto name = key.model_name + "_" + key.model_version + "_" + hex;
+	std::replace(name.begin(), name.end(), '/', '_');
+	auto extension = _option["cuda"] == false ? ".ort" : ".onnx";
+	return (std::filesystem::path(optimized_model_cache_dir) / (name + extension)).string();
+}
+
 void Orts::onnx::session::init() {
 	assert(ort_session != nullptr);
 
@@ -75,11 +467,47 @@ void Orts::onnx::session::init() {
 	for (auto &name : _outputNames)
 		outputNames.push_back(name.c_str());
 
+	// string tensors are allocated per element and cannot be bound to reusable buffers
+	auto fixed_size = [](const std::vector<value_info> &values) {
+		return std::all_of(values.begin(), values.end(), [](const value_info &info) {
+			return value_info::element_size(info.element_type) > 0;
+		});
+	};
+	if (_option["io_binding"] == true && (!fixed_size(_inputs) || !fixed_size(_outputs)))
+		_option["io_binding"] = false;
+	io_binding = _option["io_binding"] == true;
+
+	init_batching();
+
 	PLOG(L_DEBUG) << "Session created: " << key.model_name << "/" << key.model_version << std::endl;
 }
 
+void Orts::onnx::session::init_batching() {
+	auto &batching = _option["batching"];
+	if (!batching.is_object())
+		return;
+
+	// every input and output must have a dynamic first(batch) dimension and a fixed-size element type
+	auto batchable = [](const std::vector<value_info> &values) {
+		return std::all_of(values.begin(), values.end(), [](const value_info &info) {
+			return !info.shape.empty() && info.shape[0] == -1 && value_info::element_size(info.element_type) > 0;
+		});
+	};
+	if (!batchable(_inputs) || !batchable(_outputs)) {
+		PLOG(L_WARNING) << "Session " << key.model_name << "/" << key.model_version
+						<< ": batching disabled. inputs and outputs must have a dynamic batch dimension" << std::endl;
+		_option["batching"] = false;
+		return;
+	}
+
+	batcher = std::make_unique<batch_scheduler>(
+		*this, batching["max_batch_size"].get<int64_t>(), batching["max_queue_delay_us"].get<long>()
+	);
+}
+
 Orts::onnx::session::~session() {
-	delete ort_session;
+	batcher.reset();
+	replicas.clear();
 }
 
 void Orts::onnx::session::touch() {
@@ -95,25 +523,214 @@ const std::vector<Orts::onnx::value_info> &Orts::onnx::session::outputs() const
 	return _outputs;
 }
 
-std::vector<Ort::Value>
-Orts::onnx::session::run(const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values) {
+bool Orts::onnx::session::batching() const {
+	return batcher != nullptr;
+}
+
+int Orts::onnx::session::float_precision() const {
+	return _float_precision;
+}
+
+long Orts::onnx::session::timeout_ms() const {
+	return _timeout_ms;
+}
+
+Orts::task_priority Orts::onnx::session::priority() const {
+	return _priority;
+}
+
+int Orts::onnx::session::numa_node() const {
+	return _numa_node;
+}
+
+Orts::task_placement Orts::onnx::session::placement() const {
+	return {_priority, _numa_node};
+}
+
+Orts::onnx::result_cache *Orts::onnx::session::cache() const {
+	return _result_cache.get();
+}
+
+std::vector<Ort::Value> Orts::onnx::session::run(
+	const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values, deadline_t deadline
+) {
 	assert(ort_session != nullptr);
 
 	if (input_values.empty() || input_values.size() != inputCount) {
 		throw runtime_error("params size is not same as: " + std::to_string(inputCount));
 	}
+	if (run_watchdog::expired(deadline))
+		throw gateway_timeout_error("Deadline exceeded before the run started");
+
+	if (batcher != nullptr)
+		return batcher->run(input_values, deadline);
+
+	if (io_binding)
+		return run_bound(memory_info, input_values, deadline);
+
+	return run_once(input_values, deadline);
+}
+
+void Orts::onnx::session::run(
+	const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values, deadline_t deadline,
+	const batch_scheduler::completion_t &done
+) {
+	if (batcher == nullptr || input_values.size() != inputCount || run_watchdog::expired(deadline)) {
+		std::vector<Ort::Value> outputs;
+		std::exception_ptr error;
+		try {
+			outputs = run(memory_info, input_values, deadline);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		return done(outputs, error);
+	}
+
+	batcher->submit(input_values, deadline, done);
+}
+
+size_t Orts::onnx::session::select_replica() {
+	size_t selected = 0;
+	for (size_t i = 1; i < replicas.size(); i++) {
+		if (replicas[i]->in_flight.load() < replicas[selected]->in_flight.load())
+			selected = i;
+	}
+	return selected;
+}
+
+Orts::onnx::session::replica_run::replica_run(session &owner)
+	: index(owner.select_replica()), target(*owner.replicas[index]) {
+	target.in_flight++;
+	target.runs++;
+}
+
+Orts::onnx::session::replica_run::~replica_run() {
+	target.in_flight--;
+}
+
+// the bound outputs a thread left in replicas, released when the thread ends instead of when the session does
+struct Orts::onnx::session::thread_bound_tables {
+	std::vector<std::weak_ptr<bound_table>> tables;
+
+	~thread_bound_tables() {
+		for (auto &table : tables) {
+			auto locked = table.lock();
+			if (locked == nullptr)
+				continue;
+			std::lock_guard<std::mutex> lock(locked->mutex);
+			locked->threads.erase(std::this_thread::get_id());
+		}
+	}
+};
+
+Orts::onnx::session::bound_outputs &Orts::onnx::session::thread_bound_outputs(replica &target) {
+	static thread_local thread_bound_tables tables;
+
+	std::lock_guard<std::mutex> lock(target.bound->mutex);
+	auto &slot = target.bound->threads[std::this_thread::get_id()];
+	if (slot == nullptr) {
+		slot = std::make_unique<bound_outputs>(*target.ort_session);
+		// tables of replicas that are gone since are dropped here, so long-lived workers do not collect them
+		auto &list = tables.tables;
+		list.erase(
+			std::remove_if(list.begin(), list.end(), [](const auto &table) { return table.expired(); }), list.end()
+		);
+		list.emplace_back(target.bound);
+	}
+	return *slot;
+}
+
+std::vector<Ort::Value>
+Orts::onnx::session::run_once(const std::vector<Ort::Value> &input_values, deadline_t deadline) {
+	Ort::RunOptions options;
+	run_watchdog::guard guard(env->watchdog, options, deadline);
+
+	replica_run run(*this);
+	try {
+		return run.target.ort_session->Run(
+			options, inputNames.data(), input_values.data(), inputCount, outputNames.data(), outputCount
+		);
+	} catch (Ort::Exception &) {
+		if (run_watchdog::expired(deadline))
+			throw gateway_timeout_error("Deadline exceeded while running");
+		throw;
+	}
+}
 
+std::vector<Ort::Value> Orts::onnx::session::run_bound(
+	const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values, deadline_t deadline
+) {
 	Ort::RunOptions options;
+	run_watchdog::guard guard(env->watchdog, options, deadline);
 
-	return ort_session->Run(
-		options, inputNames.data(), input_values.data(), inputCount, outputNames.data(), outputCount
-	);
+	// outputs are allocated by ORT on the first run with these input shapes and reused by the later ones
+	std::vector<int64_t> signature;
+	for (auto &value : input_values) {
+		auto shape = value.GetTensorTypeAndShapeInfo().GetShape();
+		signature.push_back((int64_t)shape.size());
+		signature.insert(signature.end(), shape.begin(), shape.end());
+	}
+
+	replica_run run(*this);
+	auto &selected = run.target;
+	auto state = &thread_bound_outputs(selected);
+
+	try {
+		state->binding.ClearBoundInputs();
+		state->binding.ClearBoundOutputs();
+		for (size_t i = 0; i < inputCount; i++)
+			state->binding.BindInput(inputNames[i], input_values[i]);
+
+		auto cached = state->outputs.find(signature);
+		if (cached != state->outputs.end()) {
+			try {
+				for (size_t i = 0; i < outputCount; i++)
+					state->binding.BindOutput(outputNames[i], cached->second[i]);
+				selected.ort_session->Run(options, state->binding);
+			} catch (Ort::Exception &) {
+				if (run_watchdog::expired(deadline))
+					throw;
+				// the output shape depends on the input values, not only on their shapes. stop reusing it
+				state->outputs.erase(cached);
+				cached = state->outputs.end();
+				state->binding.ClearBoundOutputs();
+			}
+		}
+
+		if (cached == state->outputs.end()) {
+			for (size_t i = 0; i < outputCount; i++)
+				state->binding.BindOutput(outputNames[i], memory_info);
+			selected.ort_session->Run(options, state->binding);
+
+			if (state->outputs.size() >= 8)
+				state->outputs.clear();
+			cached = state->outputs.emplace(signature, state->binding.GetOutputValues()).first;
+		}
+
+		std::vector<Ort::Value> outputs;
+		outputs.reserve(outputCount);
+		for (auto &value : cached->second) {
+			auto info = value.GetTensorTypeAndShapeInfo();
+			auto shape = info.GetShape();
+			outputs.emplace_back(Ort::Value::CreateTensor(
+				memory_info, value.GetTensorMutableRawData(),
+				info.GetElementCount() * value_info::element_size(info.GetElementType()), shape.data(), shape.size(),
+				info.GetElementType()
+			));
+		}
+		return outputs;
+	} catch (Ort::Exception &) {
+		if (run_watchdog::expired(deadline))
+			throw gateway_timeout_error("Deadline exceeded while running");
+		throw;
+	}
 }
 
 json onnxruntime_server::onnx::session::to_json() const {
 	json::object_t dict;
 	dict["model"] = key.model_name;
 	dict["version"] = key.model_version;
+	dict["state"] = "ready";
 	dict["created_at"] = std::chrono::system_clock::to_time_t(created_at);
 	dict["last_executed_at"] = std::chrono::system_clock::to_time_t(last_executed_at);
 	dict["execution_count"] = execution_count;
@@ -130,6 +747,14 @@ json onnxruntime_server::onnx::session::to_json() const {
 	}
 	dict["outputs"] = outputs;
 	dict["option"] = _option;
+	if (_result_cache != nullptr)
+		dict["result_cache"] = _result_cache->to_json();
+
+	json::array_t replica_stats;
+	for (auto &r : replicas) {
+		replica_stats.push_back({{"runs", r->runs.load()}, {"in_flight", r->in_flight.load()}});
+	}
+	dict["replicas"] = replica_stats;
 
 	return dict;
 }
@@ -22,6 +22,14 @@ Orts::onnx::session_key::session_key(std::string model_name, std::string model_v
 	}
 }
 
+Orts::onnx::session_key::session_key(unchecked_t, std::string model_name, std::string model_version)
+	: model_name(std::move(model_name)), model_version(std::move(model_version)) {
+}
+
+Orts::onnx::session_key Orts::onnx::session_key::unchecked(std::string model_name, std::string model_version) {
+	return {unchecked_t{}, std::move(model_name), std::move(model_version)};
+}
+
 bool Orts::onnx::session_key::operator<(const Orts::onnx::session_key &other) const {
 	if (model_name < other.model_name)
 		return true;
@@ -30,6 +38,15 @@ bool Orts::onnx::session_key::operator<(const Orts::onnx::session_key &other) co
 	return model_version < other.model_version;
 }
 
+bool Orts::onnx::session_key::operator==(const Orts::onnx::session_key &other) const {
+	return model_name == other.model_name && model_version == other.model_version;
+}
+
+size_t Orts::onnx::session_key::hash::operator()(const Orts::onnx::session_key &key) const {
+	auto seed = std::hash<std::string>()(key.model_name);
+	return seed ^ (std::hash<std::string>()(key.model_version) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
 bool onnxruntime_server::onnx::session_key::is_valid_model_name(const std::string &model_key) {
 	if (model_key.empty())
 		return false;
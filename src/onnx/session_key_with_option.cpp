@@ -3,6 +3,7 @@
 //
 
 #include <regex>
+#include <set>
 
 #include "../onnxruntime_server.hpp"
 
@@ -15,6 +16,26 @@ std::regex key_re(key_rule);
 std::string option_rule = R"(([_a-zA-Z0-9]+)\s*=\s*([^,\s]+))";
 std::regex option_re(option_rule);
 
+// session options: short alias -> option JSON key
+std::map<std::string, std::string> option_aliases = {
+	{"intra", "intra_op_num_threads"},
+	{"inter", "inter_op_num_threads"},
+	{"mode", "execution_mode"},
+	{"opt", "graph_optimization_level"},
+	{"arena", "enable_cpu_mem_arena"},
+	{"mem_pattern", "enable_mem_pattern"},
+	{"spin", "allow_spinning"},
+	{"share", "share_weights"},
+	{"pin", "pin_replicas"},
+};
+std::set<std::string> integer_options = {
+	"intra_op_num_threads", "inter_op_num_threads", "float_precision", "replicas", "timeout_ms", "numa_node"
+};
+std::set<std::string> boolean_options = {
+	"global_thread_pool", "enable_cpu_mem_arena", "enable_mem_pattern", "allow_spinning", "share_weights", "pin_replicas", "io_binding"
+};
+std::set<std::string> string_options = {"execution_mode", "graph_optimization_level", "priority"};
+
 std::vector<Orts::onnx::session_key_with_option>
 onnxruntime_server::onnx::session_key_with_option::parse(const std::string &model_key_list) {
 	// model_key_list is a space separated list of model_name:model_version
@@ -34,6 +55,8 @@ onnxruntime_server::onnx::session_key_with_option::parse(const std::string &mode
 			while (std::regex_search(option_str, options, option_re)) {
 				auto option_key = options[1].str();
 				auto option_val = options[2].str();
+				if (option_aliases.find(option_key) != option_aliases.end())
+					option_key = option_aliases[option_key];
 
 				// cuda option: device_id or true/false
 				if (option_key == "cuda") {
@@ -43,6 +66,34 @@ onnxruntime_server::onnx::session_key_with_option::parse(const std::string &mode
 						option[option_key] = std::stoi(option_val);
 				}
 
+				// batching option: batching=true/false, max_batch_size=N, max_queue_delay_us=N
+				if (option_key == "batching") {
+					if (option_val != "true" || !option["batching"].is_object())
+						option["batching"] = option_val == "true";
+				} else if (option_key == "max_batch_size" || option_key == "max_queue_delay_us") {
+					if (!option["batching"].is_object())
+						option["batching"] = json::object();
+					option["batching"][option_key] = std::stol(option_val);
+				}
+
+				// result cache option: result_cache=true/false, cache_max_bytes=N, cache_ttl_ms=N
+				if (option_key == "result_cache") {
+					if (option_val != "true" || !option["result_cache"].is_object())
+						option["result_cache"] = option_val == "true";
+				} else if (option_key == "cache_max_bytes" || option_key == "cache_ttl_ms") {
+					if (!option["result_cache"].is_object())
+						option["result_cache"] = json::object();
+					option["result_cache"][option_key.substr(6)] = std::stol(option_val);
+				}
+
+				// threading and graph optimization options
+				if (integer_options.count(option_key))
+					option[option_key] = std::stol(option_val);
+				else if (boolean_options.count(option_key))
+					option[option_key] = option_val == "true";
+				else if (string_options.count(option_key))
+					option[option_key] = option_val;
+
 				option_str = options.suffix().str();
 			}
 		}
@@ -5,65 +5,255 @@
 #include "../onnxruntime_server.hpp"
 
 Orts::onnx::session_manager::session_manager(const model_bin_getter_t &model_bin_getter, long num_threads)
-	: model_bin_getter(model_bin_getter), thread_pool(num_threads) {
+	: sessions(std::make_shared<const session_map_t>()), model_bin_getter(model_bin_getter),
+	  env(std::make_shared<environment>(true)), thread_pool(num_threads), loader_pool(1) {
 	assert(model_bin_getter != nullptr);
 }
 
+static std::vector<int> worker_cpus(const Orts::config &config) {
+	if (config.worker_cpus.empty())
+		return {};
+	auto cpus = Orts::onnx::cpu_topology::parse_cpu_list(config.worker_cpus);
+	if (cpus.empty())
+		throw Orts::bad_request_error("Invalid CPU list: " + config.worker_cpus);
+	return cpus;
+}
+
+static std::vector<int> worker_nodes(const Orts::config &config) {
+	return Orts::onnx::cpu_topology::host().worker_nodes(worker_cpus(config), config.num_threads);
+}
+
+static std::function<void(std::size_t)> pin_worker(const Orts::config &config) {
+	auto cpus = worker_cpus(config);
+	if (cpus.empty())
+		return nullptr;
+	return [cpus](std::size_t worker) {
+		auto cpu = cpus[worker % cpus.size()];
+		if (!Orts::onnx::cpu_topology::pin_current_thread({cpu}))
+			PLOG(L_WARNING) << "Failed to pin worker " << worker << " to CPU " << cpu << std::endl;
+	};
+}
+
+Orts::onnx::session_manager::session_manager(const class config &config)
+	: sessions(std::make_shared<const session_map_t>()), model_bin_getter(config.model_bin_getter),
+	  model_cache_dir(config.model_cache_dir),
+	  env(std::make_shared<environment>(
+		  config.global_thread_pool, config.intra_op_threads, config.inter_op_threads
+	  )),
+	  thread_pool(config.num_threads, worker_nodes(config), pin_worker(config)),
+	  loader_pool(std::max(config.loader_threads, 1L)) {
+	assert(model_bin_getter != nullptr);
+	thread_pool.set_limits((size_t)std::max(config.max_queue_depth, 0L), std::max(config.max_queue_wait_ms, 0L));
+}
+
 Orts::onnx::session_manager::~session_manager() {
 	thread_pool.flush();
+	loader_pool.flush();
+}
+
+bool Orts::onnx::session_manager::is_ready() const {
+	return ready.load();
+}
+
+void Orts::onnx::session_manager::set_ready(bool value) {
+	ready.store(value);
+}
+
+json Orts::onnx::session_manager::stats() {
+	json workers = json::object();
+	workers["threads"] = thread_pool.size();
+	workers["queue_depth"] = thread_pool.queue_depth();
+	workers["lanes"] = json::object();
+	for (auto priority : {task_priority::high, task_priority::normal, task_priority::low})
+		workers["lanes"][builtin_thread_pool::priority_name(priority)] = thread_pool.queue_depth(priority);
+	workers["estimated_wait_ms"] = thread_pool.estimated_wait_ms();
+	workers["rejected"] = thread_pool.rejected();
+	return json::object({{"workers", workers}});
+}
+
+std::map<Orts::onnx::session_key, std::shared_ptr<Orts::onnx::session>>
+Orts::onnx::session_manager::get_sessions() const {
+	auto snapshot = std::atomic_load(&sessions);
+	return {snapshot->begin(), snapshot->end()};
 }
 
 std::shared_ptr<Orts::onnx::session>
 Orts::onnx::session_manager::get_session(const std::string &model_name, const std::string &model_version) {
-	auto key = session_key(model_name, model_version);
-	return get_session(key);
+	return get_session(session_key::unchecked(model_name, model_version));
 }
 
 std::shared_ptr<Orts::onnx::session> Orts::onnx::session_manager::get_session(const Orts::onnx::session_key &key) {
-	std::lock_guard<std::recursive_mutex> lock(mutex);
-	auto it = sessions.find(key);
-	if (it == sessions.end())
+	auto snapshot = std::atomic_load(&sessions);
+	auto it = snapshot->find(key);
+	if (it == snapshot->end())
 		return nullptr;
 	return it->second;
 }
 
+std::vector<Orts::onnx::session_manager::loading_session>
+Orts::onnx::session_manager::get_loading_sessions() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<loading_session> result;
+	for (auto &it : loading)
+		result.push_back(it.second);
+	return result;
+}
+
+std::optional<Orts::onnx::session_manager::loading_session>
+Orts::onnx::session_manager::get_loading_session(const Orts::onnx::session_key &key) const {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = loading.find(key);
+	if (it == loading.end())
+		return std::nullopt;
+	return it->second;
+}
+
 std::shared_ptr<Orts::onnx::session> Orts::onnx::session_manager::create_session(
 	const std::string &model_name, const std::string &model_version, const json &option, const char *model_data,
 	size_t model_data_length
+) {
+	return load_session(model_name, model_version, option, model_data, model_data_length).get();
+}
+
+void Orts::onnx::session_manager::create_session(
+	const std::string &model_name, const std::string &model_version, const json &option, const char *model_data,
+	size_t model_data_length, load_callback_t done
+) {
+	assert(done != nullptr);
+	start_load(model_name, model_version, option, model_data, model_data_length, std::move(done));
+}
+
+Orts::onnx::session_manager::session_future_t Orts::onnx::session_manager::load_session(
+	const std::string &model_name, const std::string &model_version, const json &option, const char *model_data,
+	size_t model_data_length
+) {
+	return start_load(model_name, model_version, option, model_data, model_data_length, nullptr);
+}
+
+Orts::onnx::session_manager::session_future_t Orts::onnx::session_manager::start_load(
+	const std::string &model_name, const std::string &model_version, const json &option, const char *model_data,
+	size_t model_data_length, load_callback_t done
 ) {
 	auto key = session_key(model_name, model_version);
 
+	// inline model data belongs to the request, which may be gone before the loader picks it up
+	onnx::model_bin bin;
+	if (model_data != nullptr && model_data_length > 0)
+		bin = onnx::model_bin(std::string(model_data, model_data_length));
+	else if (option.contains("path") && option["path"].is_string())
+		bin = onnx::model_bin::from_path(option["path"].get<std::string>());
+
+	auto task = std::make_shared<std::packaged_task<std::shared_ptr<session>()>>([this, key, option, bin]() mutable {
+		return load(key, option, std::move(bin));
+	});
+
+	session_future_t result;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (get_session(key) != nullptr)
+			throw conflict_error("session already exists");
+
+		// registered under the lock that load() takes to finish, so a load cannot complete unnoticed
+		if (done != nullptr)
+			waiters[key].push_back(std::move(done));
+
+		auto it = loading.find(key);
+		if (it != loading.end())
+			return it->second.result;
+
+		result = task->get_future().share();
+		loading.emplace(key, loading_session{key, option, std::chrono::system_clock::now(), result});
+	}
+
+	// a load requested from the loader pool itself would wait on its own worker
+	if (loader_pool.is_worker_thread())
+		(*task)();
+	else
+		loader_pool.enqueue([task]() { (*task)(); });
+	return result;
+}
+
+std::shared_ptr<Orts::onnx::session>
+Orts::onnx::session_manager::load(const session_key &key, const json &option, model_bin bin) {
+	auto started_at = std::chrono::steady_clock::now();
 	std::shared_ptr<Orts::onnx::session> session = nullptr;
-	std::lock_guard<std::recursive_mutex> lock(mutex);
-
-	auto current_session = get_session(key);
-	if (current_session != nullptr)
-		throw conflict_error("session already exists");
-
-	if (model_data != nullptr && model_data_length > 0) {
-		session = std::make_shared<onnx::session>(key, model_data, model_data_length, option);
-	} else if (option.contains("path") && option["path"].is_string()) {
-		session = std::make_shared<onnx::session>(key, option["path"].get<std::string>(), option);
-	} else {
-		auto model_bin = model_bin_getter(model_name, model_version);
-		model_data = model_bin.data();
-		model_data_length = model_bin.size();
-		session = std::make_shared<onnx::session>(key, model_data, model_data_length, option);
+	try {
+		// the model is loaded without holding the writer lock so that slow loads never block lookups or other writers
+		if (!bin.has_data() && bin.path.empty())
+			bin = model_bin_getter(key.model_name, key.model_version);
+
+		session = std::make_shared<onnx::session>(key, bin, option, env, model_cache_dir);
+	} catch (std::exception &e) {
+		PLOG(L_WARNING) << "session_manager: failed to load " << key.model_name << ":" << key.model_version << ": "
+						<< e.what() << std::endl;
+		finish_load(key, nullptr, std::current_exception());
+		throw;
 	}
-	sessions.emplace(key, session);
+
+	finish_load(key, session, nullptr);
+
+	PLOG(L_INFO) << "session_manager: loaded " << key.model_name << ":" << key.model_version << " in "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started_at)
+						.count()
+				 << "ms" << std::endl;
 	return session;
 }
 
+void Orts::onnx::session_manager::finish_load(
+	const session_key &key, const std::shared_ptr<session> &session, std::exception_ptr error
+) {
+	std::vector<load_callback_t> callbacks;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		loading.erase(key);
+		if (session != nullptr) {
+			auto next = std::make_shared<session_map_t>(*std::atomic_load(&sessions));
+			next->emplace(key, session);
+			std::atomic_store(&sessions, std::shared_ptr<const session_map_t>(std::move(next)));
+		}
+
+		auto it = waiters.find(key);
+		if (it != waiters.end()) {
+			callbacks = std::move(it->second);
+			waiters.erase(it);
+		}
+	}
+
+	// outside the lock, so that a callback may look up or create sessions
+	for (auto &done : callbacks) {
+		try {
+			done(session, error);
+		} catch (std::exception &e) {
+			PLOG(L_WARNING) << "session_manager: load callback failed: " << e.what() << std::endl;
+		}
+	}
+}
+
 void Orts::onnx::session_manager::remove_session(const std::string &model_name, const std::string &model_version) {
 	auto key = session_key(model_name, model_version);
 	remove_session(key);
 }
 
 void Orts::onnx::session_manager::remove_session(const Orts::onnx::session_key &key) {
-	std::lock_guard<std::recursive_mutex> lock(mutex);
-	auto it = sessions.find(key);
-	if (it == sessions.end()) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto current = std::atomic_load(&sessions);
+	if (current->find(key) == current->end()) {
+		if (loading.find(key) != loading.end())
+			throw conflict_error("session is still loading");
 		throw not_found_error("session not found");
 	}
-	sessions.erase(it);
+
+	auto next = std::make_shared<session_map_t>(*current);
+	next->erase(key);
+	std::atomic_store(&sessions, std::shared_ptr<const session_map_t>(std::move(next)));
+}
+
+json Orts::onnx::session_manager::loading_session::to_json() const {
+	json::object_t dict;
+	dict["model"] = key.model_name;
+	dict["version"] = key.model_version;
+	dict["state"] = "loading";
+	dict["created_at"] = std::chrono::system_clock::to_time_t(started_at);
+	dict["option"] = option;
+	return dict;
 }
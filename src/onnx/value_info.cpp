@@ -2,6 +2,10 @@
 // Created by Kibae Shin on 2023/09/02.
 //
 
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+
 #include "../onnxruntime_server.hpp"
 
 Orts::onnx::value_info::value_info(std::string name, ONNXTensorElementDataType element_type, std::vector<int64_t> shape)
@@ -63,6 +67,32 @@ const char *Orts::onnx::value_info::type_name(ONNXTensorElementDataType element_
 	}
 }
 
+size_t Orts::onnx::value_info::element_size(ONNXTensorElementDataType element_type) {
+	switch (element_type) {
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+		return sizeof(float);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+		return 1;
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+		return 2;
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+		return 4;
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+		return 8;
+	default:
+		// string, complex and undefined types have no fixed-size raw representation
+		return 0;
+	}
+}
+
 json::array_t values_fit_shape(json::array_t &values, std::vector<int64_t> &shape, size_t depth) {
 	depth--;
 	if (depth <= 0)
@@ -144,3 +174,112 @@ json::array_t Orts::onnx::value_info::get_tensor_data(Ort::Value &tensors) const
 	auto dims = tensors.GetTensorTypeAndShapeInfo().GetShape();
 	return values_fit_shape(values, dims, dims.size());
 }
+
+template <typename T, typename W>
+static void write_json_array(
+	std::string &out, const T *data, const std::vector<int64_t> &dims, size_t depth, size_t &index, W &write
+) {
+	out += '[';
+	for (int64_t i = 0; i < dims[depth]; i++) {
+		if (i > 0)
+			out += ',';
+		if (depth + 1 < dims.size())
+			write_json_array(out, data, dims, depth + 1, index, write);
+		else
+			write(out, data[index++]);
+	}
+	out += ']';
+}
+
+template <typename T, typename W> static void write_json_tensor(std::string &out, Ort::Value &tensors, W write) {
+	auto info = tensors.GetTensorTypeAndShapeInfo();
+	auto dims = info.GetShape();
+	auto data = tensors.GetTensorData<T>();
+
+	// same layout as get_tensor_data: a scalar is written as a single element array
+	if (dims.empty()) {
+		out += '[';
+		if (info.GetElementCount() > 0)
+			write(out, data[0]);
+		out += ']';
+		return;
+	}
+
+	size_t index = 0;
+	write_json_array(out, data, dims, 0, index, write);
+}
+
+template <typename T> static void write_json_integer(std::string &out, T value) {
+	char buffer[24];
+	auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+	out.append(buffer, end - buffer);
+}
+
+static void write_json_float(std::string &out, double value, int precision) {
+	if (!std::isfinite(value)) {
+		out += "null";
+		return;
+	}
+
+	char buffer[64];
+	if (precision > 0) {
+		auto length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+		out.append(buffer, length);
+	} else {
+		// shortest round-trip form, identical to json::dump()
+		auto end = ::nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+		out.append(buffer, end - buffer);
+	}
+}
+
+#define WRITE_JSON_INTEGER(type)                                                                                       \
+	write_json_tensor<type>(out, tensors, [](std::string &out, type value) { write_json_integer(out, value); });        \
+	break;
+
+#define WRITE_JSON_FLOAT(type)                                                                                         \
+	write_json_tensor<type>(out, tensors, [float_precision](std::string &out, const type &value) {                    \
+		write_json_float(out, (double)(float)value, float_precision);                                                  \
+	});                                                                                                                \
+	break;
+
+void Orts::onnx::value_info::write_tensor_json(Ort::Value &tensors, std::string &out, int float_precision) const {
+	switch (element_type) {
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT: // maps to c type float
+		WRITE_JSON_FLOAT(float);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+		WRITE_JSON_FLOAT(Ort::Float16_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+		WRITE_JSON_FLOAT(Ort::BFloat16_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE: // maps to c type double
+		write_json_tensor<double>(out, tensors, [float_precision](std::string &out, double value) {
+			write_json_float(out, value, float_precision);
+		});
+		break;
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8: // maps to c type uint8_t
+		WRITE_JSON_INTEGER(uint8_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8: // maps to c type int8_t
+		WRITE_JSON_INTEGER(int8_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16: // maps to c type uint16_t
+		WRITE_JSON_INTEGER(uint16_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16: // maps to c type int16_t
+		WRITE_JSON_INTEGER(int16_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32: // maps to c type int32_t
+		WRITE_JSON_INTEGER(int32_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64: // maps to c type int64_t
+		WRITE_JSON_INTEGER(int64_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32: // maps to c type uint32_t
+		WRITE_JSON_INTEGER(uint32_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64: // maps to c type uint64_t
+		WRITE_JSON_INTEGER(uint64_t);
+	case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+		write_json_tensor<bool>(out, tensors, [](std::string &out, bool value) { out += value ? "true" : "false"; });
+		break;
+	default:
+		// strings need escaping and other types are not supported, so they go through the json DOM
+		out += json(get_tensor_data(tensors)).dump();
+		break;
+	}
+}
+
+#undef WRITE_JSON_INTEGER
+#undef WRITE_JSON_FLOAT
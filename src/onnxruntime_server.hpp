@@ -5,13 +5,20 @@
 #ifndef ONNX_RUNTIME_SERVER_HPP
 #define ONNX_RUNTIME_SERVER_HPP
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <iostream>
 #include <list>
+#include <map>
+#include <optional>
 #include <queue>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "thread_pool.hpp"
@@ -34,11 +41,129 @@ using ordered_json = nlohmann::ordered_json;
  * namespace shorthand: Orts
  */
 namespace onnxruntime_server {
-	typedef std::function<std::string(const std::string &, const std::string &)> model_bin_getter_t;
+	namespace onnx {
+		class model_bin;
+	}
+
+	typedef std::function<onnx::model_bin(const std::string &, const std::string &)> model_bin_getter_t;
+
+	class config;
 
 	namespace onnx {
 		std::string version();
 
+		/**
+		 * model_bin is the model handed to ONNX Runtime: either a file path that ONNX Runtime opens itself, or a
+		 * read-only byte range kept alive by holder. The bytes only need to live until the session is initialized.
+		 */
+		class model_bin {
+		  public:
+			std::string path;
+			const char *data = nullptr;
+			size_t length = 0;
+			std::shared_ptr<const void> holder;
+
+			model_bin() = default;
+			// owns a copy of the model in memory. keeps model_bin_getter_t compatible with getters returning a string
+			model_bin(std::string bin);
+
+			[[nodiscard]] bool has_data() const;
+
+			static model_bin from_path(std::string path);
+			// maps the file read-only. pages are shared with the page cache instead of copied into the process
+			static model_bin map_file(const std::string &path);
+		};
+
+		/**
+		 * cpu_topology maps logical CPUs to NUMA nodes. It is read from sysfs on Linux; elsewhere, or when the kernel
+		 * reports no nodes, every CPU is on node 0.
+		 */
+		class cpu_topology {
+		  private:
+			std::map<int, std::vector<int>> cpus_by_node;
+
+		  public:
+			explicit cpu_topology(std::map<int, std::vector<int>> cpus_by_node);
+
+			static const cpu_topology &host();
+
+			[[nodiscard]] std::vector<int> nodes() const;
+			// empty for a node that does not exist
+			[[nodiscard]] std::vector<int> node_cpus(int node) const;
+			// -1 for a CPU that does not exist
+			[[nodiscard]] int node_of(int cpu) const;
+			// node of each of workers threads, worker i running on the i-th CPU of cpus (wrapping around)
+			[[nodiscard]] std::vector<int> worker_nodes(const std::vector<int> &cpus, long workers) const;
+
+			// "0-3,8" is {0, 1, 2, 3, 8}
+			static std::vector<int> parse_cpu_list(const std::string &list);
+			static std::string to_cpu_list(const std::vector<int> &cpus);
+
+			// restricts the calling thread to cpus. false where thread affinity is not supported
+			static bool pin_current_thread(const std::vector<int> &cpus);
+
+			// pins the calling thread to cpus while it lives, then gives back the CPUs it had before
+			class pin_scope {
+				std::vector<int> previous;
+
+			  public:
+				explicit pin_scope(const std::vector<int> &cpus);
+				~pin_scope();
+				pin_scope(const pin_scope &) = delete;
+				pin_scope &operator=(const pin_scope &) = delete;
+			};
+		};
+
+		// point in time after which nobody waits for the result of a run. max() means no deadline
+		typedef std::chrono::steady_clock::time_point deadline_t;
+
+		// terminates runs that are still in progress when their deadline passes. the thread starts with the first run
+		class run_watchdog {
+		  private:
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::multimap<deadline_t, Ort::RunOptions *> runs;
+			bool stop = false;
+			std::thread worker;
+
+			void loop();
+
+		  public:
+			~run_watchdog();
+
+			// watches one run for as long as it lives. nothing is registered without a deadline
+			class guard {
+				run_watchdog &owner;
+				Ort::RunOptions *options = nullptr;
+				deadline_t deadline;
+
+			  public:
+				guard(run_watchdog &owner, Ort::RunOptions &options, deadline_t deadline);
+				~guard();
+				guard(const guard &) = delete;
+				guard &operator=(const guard &) = delete;
+			};
+
+			static bool expired(deadline_t deadline);
+		};
+
+		/**
+		 * environment holds the ORT state shared by all sessions of a session_manager.
+		 * With global thread pools, every session that opts in runs on the same intra/inter-op thread pools instead of
+		 * spawning its own.
+		 */
+		class environment {
+		  public:
+			const bool global_thread_pools;
+			Ort::Env env;
+			// sessions created with share_weights keep one copy of each prepacked weight instead of one per session
+			Ort::PrepackedWeightsContainer prepacked_weights;
+
+			explicit environment(bool global_thread_pools = false, long intra_op_threads = 0, long inter_op_threads = 0);
+
+			run_watchdog watchdog;
+		};
+
 		class value_info {
 		  public:
 			const std::string name;
@@ -50,8 +175,10 @@ namespace onnxruntime_server {
 			[[nodiscard]] std::string type_name() const;
 			[[nodiscard]] std::string type_to_string() const;
 			static const char *type_name(ONNXTensorElementDataType element_type);
+			static size_t element_size(ONNXTensorElementDataType element_type);
 
 			json::array_t get_tensor_data(Ort::Value &tensors) const;
+			void write_tensor_json(Ort::Value &tensors, std::string &out, int float_precision = 0) const;
 		};
 
 		class session_key {
@@ -61,6 +188,20 @@ namespace onnxruntime_server {
 
 			session_key(std::string model_name, std::string model_version);
 			bool operator<(const session_key &other) const;
+			bool operator==(const session_key &other) const;
+
+			// builds a key for lookups only; names that fail validation simply never match a session
+			static session_key unchecked(std::string model_name, std::string model_version);
+
+			struct hash {
+				size_t operator()(const session_key &key) const;
+			};
+
+		  private:
+			struct unchecked_t {};
+			session_key(unchecked_t, std::string model_name, std::string model_version);
+
+		  public:
 
 			static bool is_valid_model_name(const std::string &model_key);
 			static bool is_valid_model_version(const std::string &model_version);
@@ -77,11 +218,141 @@ namespace onnxruntime_server {
 			static std::vector<session_key_with_option> parse(const std::string &model_key_list);
 		};
 
+		class session;
+
+		/**
+		 * batch_scheduler collects concurrent run requests of one session and executes them as a single batch.
+		 * Inputs are concatenated along the first(batch) dimension, and the output rows are scattered back to each
+		 * waiting request.
+		 */
+		class batch_scheduler {
+		  public:
+			// gets the outputs of one request, or the error of its batch. called once, on the scheduler thread
+			typedef std::function<void(std::vector<Ort::Value> &outputs, std::exception_ptr error)> completion_t;
+
+		  private:
+			struct request {
+				const std::vector<Ort::Value> *input_values;
+				int64_t rows;
+				std::chrono::steady_clock::time_point enqueued_at;
+				deadline_t deadline;
+				completion_t done;
+			};
+
+			session &owner;
+			const int64_t max_batch_size;
+			const std::chrono::microseconds max_queue_delay;
+			Ort::AllocatorWithDefaultOptions allocator;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::deque<std::shared_ptr<request>> queue;
+			bool stop = false;
+			std::thread worker;
+
+			void loop();
+			int64_t queued_rows();
+			std::vector<std::shared_ptr<request>> take_expired();
+			std::vector<std::shared_ptr<request>> take_batch();
+			void execute(std::vector<std::shared_ptr<request>> &batch);
+			std::vector<std::vector<Ort::Value>> run_batch(std::vector<std::shared_ptr<request>> &batch);
+			static void complete(request &req, std::vector<Ort::Value> outputs, std::exception_ptr error);
+
+			static int64_t count_rows(const std::vector<Ort::Value> &input_values);
+			static bool is_compatible(const request &a, const request &b);
+
+		  public:
+			batch_scheduler(session &owner, int64_t max_batch_size, long max_queue_delay_us);
+			~batch_scheduler();
+
+			std::vector<Ort::Value>
+			run(const std::vector<Ort::Value> &input_values, deadline_t deadline = deadline_t::max());
+			// queues the request and returns right away. input_values must stay valid until done is called
+			void submit(const std::vector<Ort::Value> &input_values, deadline_t deadline, completion_t done);
+		};
+
+		/**
+		 * result_cache keeps serialized outputs of one session keyed by a hash of the request inputs, so identical
+		 * requests skip the model. Least recently used entries go first once the values exceed max_bytes, and entries
+		 * older than ttl_ms are not served.
+		 */
+		class result_cache {
+		  public:
+			// xxHash64 of the bytes, chained through seed so that several buffers make one key
+			static uint64_t hash(const void *data, size_t length, uint64_t seed = 0);
+
+			result_cache(size_t max_bytes, long ttl_ms);
+
+			std::optional<std::string> get(uint64_t key);
+			void put(uint64_t key, std::string value);
+
+			// hits, misses and evictions since the session was created, and the current entries and bytes
+			[[nodiscard]] json to_json() const;
+
+		  private:
+			struct entry {
+				uint64_t key;
+				std::string value;
+				std::chrono::steady_clock::time_point stored_at;
+			};
+
+			const size_t max_bytes;
+			const std::chrono::milliseconds ttl;
+
+			mutable std::mutex mutex;
+			// most recently used first
+			std::list<entry> entries;
+			std::unordered_map<uint64_t, std::list<entry>::iterator> index;
+			size_t bytes = 0;
+			long hits = 0;
+			long misses = 0;
+			long evictions = 0;
+
+			static size_t entry_bytes(const entry &e);
+			void erase(std::list<entry>::iterator it);
+		};
+
 		class session {
 		  private:
-			Ort::Env env;
+			std::shared_ptr<environment> env;
 			Ort::SessionOptions session_options;
+			// output tensors of one thread, kept per input shapes and rebound by the next run with the same shapes
+			struct bound_outputs {
+				Ort::IoBinding binding;
+				std::map<std::vector<int64_t>, std::vector<Ort::Value>> outputs;
+
+				explicit bound_outputs(Ort::Session &ort_session) : binding(ort_session) {
+				}
+			};
+
+			// shared with the threads that ran on the replica, which drop their entry when they end
+			struct bound_table {
+				std::mutex mutex;
+				std::map<std::thread::id, std::unique_ptr<bound_outputs>> threads;
+			};
+			// the bound tables a thread has entries in
+			struct thread_bound_tables;
+
+			struct replica {
+				Ort::Session *ort_session;
+				std::atomic<long> in_flight{0};
+				std::atomic<uint64_t> runs{0};
+				std::shared_ptr<bound_table> bound = std::make_shared<bound_table>();
+
+				explicit replica(Ort::Session *ort_session) : ort_session(ort_session) {
+				}
+				~replica() {
+					{
+						std::lock_guard<std::mutex> lock(bound->mutex);
+						bound->threads.clear();
+					}
+					delete ort_session;
+				}
+			};
+
+			// the first replica. owned by replicas
 			Ort::Session *ort_session{};
+			std::vector<std::unique_ptr<replica>> replicas;
 			std::chrono::system_clock::time_point created_at;
 			std::chrono::system_clock::time_point last_executed_at;
 			long execution_count = 0;
@@ -99,21 +370,96 @@ namespace onnxruntime_server {
 			std::vector<const char *> outputNames;
 
 			json _option = json::object();
+			std::unique_ptr<batch_scheduler> batcher;
+			std::unique_ptr<result_cache> _result_cache;
+			int _float_precision = 0;
+			long _timeout_ms = 0;
+			task_priority _priority = task_priority::normal;
+			int _numa_node = -1;
+			bool io_binding = false;
 
 			void init();
+			void init_session_options(const json &option);
+			void create_replicas(const std::function<Ort::Session *(const Ort::SessionOptions &)> &create);
+			Ort::SessionOptions replica_options(long index);
+			Ort::Session *create_ort_session(const std::string &path, const Ort::SessionOptions &options);
+			Ort::Session *
+			create_ort_session(const char *model_data, size_t model_data_length, const Ort::SessionOptions &options);
+			[[nodiscard]] std::string
+			optimized_model_cache_path(const model_bin &bin, const std::string &optimized_model_cache_dir) const;
+			void init_batching();
+			std::vector<Ort::Value> run_once(const std::vector<Ort::Value> &input_values, deadline_t deadline);
+			std::vector<Ort::Value> run_bound(
+				const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values, deadline_t deadline
+			);
+			// index of the replica with the fewest runs in flight. the first one among equals
+			size_t select_replica();
+			static bound_outputs &thread_bound_outputs(replica &target);
+
+			friend class batch_scheduler;
 
-			explicit session(session_key key, const json &option);
+			explicit session(session_key key, const json &option, std::shared_ptr<environment> env);
 
 		  public:
+			// holds the least busy replica of the session for one run, counting the run as in flight while it lives
+			class replica_run {
+			  public:
+				const size_t index;
+				replica &target;
+
+				explicit replica_run(session &owner);
+				~replica_run();
+				replica_run(const replica_run &) = delete;
+				replica_run &operator=(const replica_run &) = delete;
+			};
+
+			// intra-op threads of the replica index of replicas running on cpus, and their
+			// session.intra_op_thread_affinities(1-based processor ids). pinned replicas split the cpus between them
+			static std::pair<long, std::string> intra_op_affinities(
+				const std::vector<int> &cpus, bool pin_replicas, long replicas, long index, long intra_op_threads
+			);
+
 			session_key key;
-			explicit session(session_key key, const std::string &path, const json &option = json::object());
 			explicit session(
-				session_key key, const char *model_data, size_t model_data_length, const json &option = json::object()
+				session_key key, const std::string &path, const json &option = json::object(),
+				std::shared_ptr<environment> env = nullptr
+			);
+			explicit session(
+				session_key key, const char *model_data, size_t model_data_length, const json &option = json::object(),
+				std::shared_ptr<environment> env = nullptr
+			);
+			// with a cache directory, the optimized graph is saved on the first load and loaded from there afterwards
+			explicit session(
+				session_key key, const model_bin &bin, const json &option, std::shared_ptr<environment> env,
+				const std::string &optimized_model_cache_dir
 			);
 			~session();
 
-			std::vector<Ort::Value>
-			run(const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values);
+			// with io_binding, the outputs view buffers that the next run of the calling thread reuses. consume them first
+			// runs past the deadline are terminated and throw gateway_timeout_error
+			std::vector<Ort::Value> run(
+				const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values,
+				deadline_t deadline = deadline_t::max()
+			);
+			// with batching, queues the inputs and returns. done runs on the batch scheduler thread once the batch has
+			// run, and input_values must stay valid until then. other sessions run and call done before returning
+			void run(
+				const Ort::MemoryInfo &memory_info, const std::vector<Ort::Value> &input_values, deadline_t deadline,
+				const batch_scheduler::completion_t &done
+			);
+			[[nodiscard]] bool batching() const;
+			// significant digits of floating point outputs in JSON. 0 writes the shortest round-trip form
+			[[nodiscard]] int float_precision() const;
+			// default time a request may take, counted from its arrival. 0 means no limit
+			[[nodiscard]] long timeout_ms() const;
+			// worker queue lane of requests that do not ask for one
+			[[nodiscard]] task_priority priority() const;
+			// NUMA node that holds the weights and runs the intra-op threads. -1 when the session is not bound to one
+			[[nodiscard]] int numa_node() const;
+			// where the worker pool should run requests of this session
+			[[nodiscard]] task_placement placement() const;
+			// nullptr unless the result_cache option is set
+			[[nodiscard]] result_cache *cache() const;
 
 			void touch();
 			json to_json() const;
@@ -123,58 +469,314 @@ namespace onnxruntime_server {
 		};
 
 		class session_manager {
+		  public:
+			typedef std::unordered_map<session_key, std::shared_ptr<session>, session_key::hash> session_map_t;
+
+			typedef std::shared_future<std::shared_ptr<session>> session_future_t;
+			// called on the loader thread with the loaded session, or with the reason the load failed
+			typedef std::function<void(std::shared_ptr<session> session, std::exception_ptr error)> load_callback_t;
+
+			// a session whose model is still being loaded on the loader thread pool
+			struct loading_session {
+				session_key key;
+				json option;
+				std::chrono::system_clock::time_point started_at;
+				session_future_t result;
+
+				[[nodiscard]] json to_json() const;
+			};
+
 		  private:
-			std::recursive_mutex mutex;
-			std::map<session_key, std::shared_ptr<session>> sessions;
+			// readers load the current snapshot without locking; writers serialize on the mutex and publish a copy
+			mutable std::mutex mutex;
+			std::shared_ptr<const session_map_t> sessions;
+			std::map<session_key, loading_session> loading;
+			std::map<session_key, std::vector<load_callback_t>> waiters;
 			model_bin_getter_t model_bin_getter;
+			std::string model_cache_dir;
+			std::shared_ptr<environment> env;
+			std::atomic<bool> ready{true};
+
+			session_future_t start_load(
+				const std::string &model_name, const std::string &model_version, const json &option,
+				const char *model_data, size_t model_data_length, load_callback_t done
+			);
+			std::shared_ptr<session> load(const session_key &key, const json &option, model_bin bin);
+			// publishes the loaded session and calls the waiters of the key
+			void finish_load(const session_key &key, const std::shared_ptr<session> &session, std::exception_ptr error);
 
 		  public:
 			explicit session_manager(const model_bin_getter_t &model_bin_getter, long num_threads);
+			explicit session_manager(const class config &config);
 			~session_manager();
 
 			builtin_thread_pool thread_pool;
+			// model loads run here so that they never occupy the request workers. declared last to be joined first
+			builtin_thread_pool loader_pool;
 
-			std::map<session_key, std::shared_ptr<session>> &get_sessions() {
-				return sessions;
-			}
+			// false while models prepared at startup are still loading. reported by the health check
+			[[nodiscard]] bool is_ready() const;
+			void set_ready(bool value);
+			// depth, estimated wait and rejections of the request worker queue
+			json stats();
+
+			std::map<session_key, std::shared_ptr<session>> get_sessions() const;
+			std::vector<loading_session> get_loading_sessions() const;
+			std::optional<loading_session> get_loading_session(const session_key &key) const;
 
 			std::shared_ptr<session> get_session(const std::string &model_name, const std::string &model_version);
 			std::shared_ptr<session> get_session(const session_key &key);
+			// blocks until the model is loaded
 			std::shared_ptr<session> create_session(
 				const std::string &model_name, const std::string &model_version, const json &option,
 				const char *model_data = nullptr, size_t model_data_length = 0
 			);
+			// returns right away and calls done once the model is loaded. throws if the load cannot be started
+			void create_session(
+				const std::string &model_name, const std::string &model_version, const json &option,
+				const char *model_data, size_t model_data_length, load_callback_t done
+			);
+			// starts loading the model on the loader pool. concurrent loads of the same key share one result
+			session_future_t load_session(
+				const std::string &model_name, const std::string &model_version, const json &option,
+				const char *model_data = nullptr, size_t model_data_length = 0
+			);
 			void remove_session(const std::string &model_name, const std::string &model_version);
 			void remove_session(const session_key &key);
 		};
 
 		namespace execution {
+			enum payload_format : int16_t {
+				PAYLOAD_JSON = 0,
+				// [uint32 header length][JSON header][raw little-endian tensor data, each aligned to 8 bytes]
+				PAYLOAD_TENSOR = 1,
+				PAYLOAD_MSGPACK = 2,
+				PAYLOAD_CBOR = 3,
+			};
+
+			json decode_payload(const char *payload, size_t length, payload_format format);
+			std::string encode_payload(const json &value, payload_format format);
+
+			// per-thread bump allocator for request-scoped buffers. allocations only move a pointer forward and the
+			// whole arena is rewound at once when the last context using it on this thread is destroyed.
+			class arena {
+				struct chunk {
+					std::unique_ptr<char[]> data;
+					size_t size;
+				};
+				std::vector<chunk> chunks;
+				size_t current = 0;
+				size_t offset = 0;
+				size_t users = 0;
+
+			  public:
+				static const size_t initial_chunk_size = 64 * 1024;
+				// chunks beyond this size are released on reset instead of being kept for the next request
+				static const size_t max_retained_size = 64 * 1024 * 1024;
+
+				// the arena of the calling thread, or the one a use on this thread points it at
+				static arena &local();
+
+				// gives a pooled arena back to the pool
+				struct recycle {
+					void operator()(arena *target) const;
+				};
+				// arenas waiting in the pool at most. the rest are freed when given back
+				static const size_t max_pooled = 64;
+				// an arena not tied to a thread, taken from a process-wide pool so its chunks are reused across requests
+				static std::unique_ptr<arena, recycle> pooled();
+
+				void *allocate(size_t bytes, size_t alignment);
+				template <typename T> T *allocate(size_t count) {
+					return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+				}
+				// only the most recent allocation is given back, which lets a growing vector reuse its tail
+				void deallocate(void *p, size_t bytes);
+				void reset();
+				size_t capacity() const;
+				size_t used() const;
+				size_t active() const;
+
+				class scope {
+					arena &owner;
+
+				  public:
+					explicit scope(arena &owner = local());
+					~scope();
+					scope(const scope &) = delete;
+					scope &operator=(const scope &) = delete;
+				};
+
+				// points local() of this thread at another arena until destroyed. nullptr keeps the thread's own
+				class use {
+					arena *previous;
+
+				  public:
+					explicit use(arena *target);
+					~use();
+					use(const use &) = delete;
+					use &operator=(const use &) = delete;
+				};
+
+				template <typename T> class allocator {
+				  public:
+					using value_type = T;
+					using propagate_on_container_copy_assignment = std::true_type;
+					using propagate_on_container_move_assignment = std::true_type;
+					using propagate_on_container_swap = std::true_type;
+
+					arena *owner;
+
+					allocator() : owner(&local()) {
+					}
+					explicit allocator(arena &owner) : owner(&owner) {
+					}
+					template <typename U> allocator(const allocator<U> &other) : owner(other.owner) {
+					}
+
+					T *allocate(size_t count) {
+						return owner->allocate<T>(count);
+					}
+					void deallocate(T *p, size_t count) {
+						owner->deallocate(p, count * sizeof(T));
+					}
+					template <typename U> bool operator==(const allocator<U> &other) const {
+						return owner == other.owner;
+					}
+					template <typename U> bool operator!=(const allocator<U> &other) const {
+						return owner != other.owner;
+					}
+				};
+				template <typename T> using vector = std::vector<T, allocator<T>>;
+			};
+
+			// SAX handler that writes the values of each model input straight into a typed buffer, inferring the shape
+			// from the array nesting. JSON, MessagePack and CBOR are decoded without building a json DOM.
+			class json_sax_decoder {
+			  public:
+				struct tensor {
+					std::vector<int64_t> shape;
+					bool ragged = false;
+					size_t count = 0;
+					arena::vector<char> data;
+					arena::vector<std::string> strings;
+				};
+				std::map<std::string, tensor> tensors;
+				// with a root key, the scalar values of the other top-level keys. containers there are skipped
+				json fields = json::object();
+				bool root_found = false;
+
+			  private:
+				const std::vector<value_info> &infos;
+				// object key the inputs are nested under, such as the data of a TCP execute request. empty when they
+				// are the top-level object
+				const std::string root;
+				size_t payload_length = 0;
+				std::string error;
+				// nesting inside the top-level object around the root: 0 before it, 1 inside it
+				size_t envelope_depth = 0;
+				bool inside_root = false;
+				bool expect_root = false;
+				std::string field;
+				size_t depth = 0;
+				// values of keys that are not model inputs are skipped
+				bool skipping = false;
+				size_t skip_depth = 0;
+				const value_info *current_info = nullptr;
+				tensor *current = nullptr;
+				// number of items seen in each open array of the current input
+				std::vector<int64_t> counts;
+				// number of items that MessagePack and CBOR announce for each open array. JSON does not
+				std::vector<size_t> announced;
+				size_t leaf_depth = 0;
+
+				bool fail(const std::string &message);
+				bool skip_scalar();
+				[[nodiscard]] bool outside_root() const;
+				bool envelope_value(json value);
+				bool leaf();
+				void reserve();
+				template <typename T> bool append(T value);
+				template <typename T> bool number(T value);
+
+			  public:
+				explicit json_sax_decoder(const std::vector<value_info> &infos, std::string root = "");
+				void parse(const char *payload, size_t length, json::input_format_t format);
+				void parse(const char *payload, size_t length, payload_format format);
+
+				bool null();
+				bool boolean(bool val);
+				bool number_integer(json::number_integer_t val);
+				bool number_unsigned(json::number_unsigned_t val);
+				bool number_float(json::number_float_t val, const json::string_t &s);
+				bool string(json::string_t &val);
+				bool binary(json::binary_t &val);
+				bool start_object(std::size_t elements);
+				bool key(json::string_t &val);
+				bool end_object();
+				bool start_array(std::size_t elements);
+				bool end_array();
+				bool parse_error(std::size_t position, const std::string &last_token, const json::exception &ex);
+			};
+
 			class input_value {
-				std::vector<std::function<void(void)>> deallocators;
+				// buffers the tensors point at. owned here so they are not given back to the arena while in use,
+				// and so the std::string objects of string tensors are destroyed with the input
+				arena::vector<char> data;
+				arena::vector<std::string> strings;
 
 			  public:
 				Ort::Value tensors = Ort::Value(nullptr);
 				input_value(
 					const Ort::MemoryInfo &memory_info, const value_info &info, const json::value_type &json_value
 				);
-				~input_value();
+				input_value(
+					const Ort::MemoryInfo &memory_info, const value_info &info, const std::vector<int64_t> &shape,
+					const char *data, size_t length
+				);
+				input_value(const Ort::MemoryInfo &memory_info, const value_info &info, json_sax_decoder::tensor &&decoded);
 
-				std::vector<int64_t> batched_shape(const std::vector<int64_t> &shape, size_t value_count);
+				static std::vector<int64_t> batched_shape(const std::vector<int64_t> &shape, size_t value_count);
 			};
 
 			class context {
 			  private:
+				// a batching session finishes the context on its scheduler thread, so the inputs get a pooled arena
+				// instead of the one of the decoding thread
+				std::unique_ptr<arena, arena::recycle> own_arena;
+				// declared before the inputs so the arena is rewound only after every input has been destroyed
+				arena::scope arena_scope;
 				Ort::MemoryInfo memory_info;
 				std::shared_ptr<onnxruntime_server::onnx::session> session;
-				std::map<std::string, input_value *> inputs;
+				// in the order of session->inputs()
+				std::vector<std::optional<input_value>> inputs;
+				// the tensors of a run handed to the batch scheduler, kept until it completes
+				std::vector<Ort::Value> submitted;
+
+				void parse_json(const json &dataset);
+				void parse_tensor_payload(const char *payload, size_t length);
+				void parse_sax(const char *payload, size_t length, json::input_format_t format, const std::string &root);
 
 			  public:
 				context(std::shared_ptr<class session> session, const json &json_str);
-				~context();
+				// with a root key, the inputs are read from the object under that key of the payload
+				context(
+					std::shared_ptr<class session> session, const char *payload, size_t length, payload_format format,
+					const std::string &root = ""
+				);
 
 				void flat_json_values(const json::value_type &data, std::vector<json::value_type> *json_values);
-				std::vector<Ort::Value> run();
+				// result_cache key of the decoded inputs: their types, shapes and values, whatever format they came in.
+				// empty when an input type has no byte representation to hash
+				[[nodiscard]] std::optional<uint64_t> input_hash() const;
+				std::vector<Ort::Value> run(deadline_t deadline = deadline_t::max());
+				// like run, but returns as soon as a batching session has queued the inputs. done gets the outputs on
+				// the batch scheduler thread, and must not let the last reference to this context go there
+				void run(deadline_t deadline, const batch_scheduler::completion_t &done);
 				json tensors_to_json(std::vector<Ort::Value> &tensors);
+				std::string tensors_to_json_text(std::vector<Ort::Value> &tensors);
+				std::string tensors_to_tensor_payload(std::vector<Ort::Value> &tensors);
+				std::string tensors_to_payload(std::vector<Ort::Value> &tensors, payload_format format);
 			};
 		} // namespace execution
 
@@ -232,6 +834,8 @@ namespace onnxruntime_server {
 			json option;
 			const char *model_data = nullptr;
 			size_t model_data_length = 0;
+			// return as soon as the load is scheduled instead of waiting for the session
+			bool async = false;
 
 			explicit create_session(
 				onnx::session_manager &onnx_session_manager, const json &request_json, const char *model_data = nullptr,
@@ -244,19 +848,82 @@ namespace onnxruntime_server {
 			);
 			std::string name() override;
 			json run() override;
+			// does not wait for the model. done is called on the loader thread, or right away when nothing is loaded
+			void run(const std::function<void(json result, std::exception_ptr error)> &done);
 		};
 
 		class execute_session : public session_task {
+		  private:
+			// key of the payload object that holds the inputs. empty when they are the whole payload
+			std::string payload_root;
+
+			explicit execute_session(
+				onnx::session_manager &onnx_session_manager, const json &envelope, const char *payload,
+				size_t payload_length, onnx::execution::payload_format format
+			);
+			std::shared_ptr<onnx::session> get_session();
+			std::unique_ptr<onnx::execution::context> create_context(std::shared_ptr<onnx::session> session);
+			onnx::deadline_t deadline(const std::shared_ptr<onnx::session> &session) const;
+			task_placement placement(const std::shared_ptr<onnx::session> &session) const;
+			// key of the request in the result cache of the session. empty when the session does not cache results
+			static std::optional<uint64_t> cache_key(
+				const std::shared_ptr<onnx::session> &session, const onnx::execution::context &ctx, int format
+			);
+			void execute(
+				const std::shared_ptr<onnx::session> &session, onnx::execution::context &ctx,
+				const std::function<void(std::vector<Ort::Value> &)> &consume
+			);
+			static void
+			check_accept(const std::shared_ptr<onnx::session> &session, onnx::execution::payload_format accept);
+			std::string run(const std::shared_ptr<onnx::session> &session, onnx::execution::payload_format accept);
+
+		  public:
+			// gets the encoded outputs, or the error of the request. called exactly once
+			typedef std::function<void(std::string result, std::exception_ptr error)> completion_t;
+
+		  private:
+			void submit(
+				std::shared_ptr<onnx::session> session, std::shared_ptr<onnx::execution::context> ctx,
+				std::optional<uint64_t> key, onnx::execution::payload_format accept, const completion_t &done
+			);
+
 		  public:
 			json data;
+			// raw request body, owned by the transport and valid until run returns
+			const char *payload = nullptr;
+			size_t payload_length = 0;
+			onnx::execution::payload_format format = onnx::execution::PAYLOAD_JSON;
+			// the timeout counts from here, so time spent waiting in the worker queue is included
+			std::chrono::steady_clock::time_point received_at = std::chrono::steady_clock::now();
+			// 0 follows the timeout_ms option of the session
+			long timeout_ms = 0;
+			// empty follows the priority option of the session
+			std::optional<task_priority> priority;
 
 			explicit execute_session(onnx::session_manager &onnx_session_manager, const json &request_json);
 			explicit execute_session(
 				onnx::session_manager &onnx_session_manager, const std::string &model_name,
 				const std::string &model_version, json data
 			);
+			explicit execute_session(
+				onnx::session_manager &onnx_session_manager, const std::string &model_name,
+				const std::string &model_version, const char *payload, size_t payload_length,
+				onnx::execution::payload_format format
+			);
+			// a whole request with model, version and the inputs under data, as the TCP transport receives it. the
+			// inputs are decoded from the payload without building a json document
+			explicit execute_session(
+				onnx::session_manager &onnx_session_manager, const char *payload, size_t payload_length,
+				onnx::execution::payload_format format
+			);
 			std::string name() override;
+			// lane and NUMA node of the session, with the priority of the request if it has one
+			task_placement placement();
 			json run() override;
+			std::string run(onnx::execution::payload_format accept);
+			// answers through done instead. a batching session queues the request for a batch and returns right away,
+			// then calls done from its scheduler thread. other sessions run and call done before this returns
+			void run(onnx::execution::payload_format accept, const completion_t &done);
 		};
 
 		class get_session : public session_task {
@@ -311,8 +978,22 @@ namespace onnxruntime_server {
 		std::string access_log_file;
 
 		long num_threads = 4;
+		// requests beyond these limits are rejected with 503 instead of queued. 0 means unlimited
+		long max_queue_depth = 0;
+		long max_queue_wait_ms = 0;
+		// CPU list like "0-15,32-47". worker i is pinned to the i-th CPU. empty leaves the workers unpinned
+		std::string worker_cpus;
+		long io_threads = 1;
+		long loader_threads = 1;
+		bool global_thread_pool = true;
+		long intra_op_threads = 0;
+		long inter_op_threads = 0;
 		std::string model_dir;
+		// optimized graphs are cached here across restarts. empty disables the cache
+		std::string model_cache_dir;
 		std::string prepare_model;
+		// open the listeners before the prepared models are loaded. the health check fails until they are
+		bool prepare_model_background = false;
 		model_bin_getter_t model_bin_getter{};
 		long request_payload_limit = 1024 * 1024 * 10;
 	};
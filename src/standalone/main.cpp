@@ -7,7 +7,7 @@
 #include "../transport/http/http_server.hpp"
 #include "../transport/tcp/tcp_server.hpp"
 
-bool terminated = false;
+std::atomic<bool> terminated{false};
 
 void on_sigterm(int) {
 	terminated = true;
@@ -23,13 +23,30 @@ int main(int argc, char *argv[]) {
 
 	{ // scope
 		boost::asio::io_context io_context;
-		Orts::onnx::session_manager manager(server.config.model_bin_getter, server.config.num_threads);
-
-		try {
-			server.prepare_models(manager);
-		} catch (std::exception &e) {
-			PLOG(L_FATAL) << "Failed to prepare models: " << e.what() << std::endl;
-			return 1;
+		Orts::onnx::session_manager manager(server.config);
+
+		bool prepare_failed = false;
+		std::thread prepare_thread;
+		if (!server.config.prepare_model_background) {
+			try {
+				server.prepare_models(manager);
+			} catch (std::exception &e) {
+				PLOG(L_FATAL) << "Failed to prepare models: " << e.what() << std::endl;
+				return 1;
+			}
+		} else {
+			// listen right away and report ready through the health check once every model is loaded
+			manager.set_ready(false);
+			prepare_thread = std::thread([&server, &manager, &prepare_failed]() {
+				try {
+					server.prepare_models(manager);
+					manager.set_ready(true);
+				} catch (std::exception &e) {
+					PLOG(L_FATAL) << "Failed to prepare models: " << e.what() << std::endl;
+					prepare_failed = true;
+					terminated = true;
+				}
+			});
 		}
 
 		std::vector<std::shared_ptr<Orts::transport::server>> servers;
@@ -63,9 +80,22 @@ int main(int argc, char *argv[]) {
 #endif
 
 		auto timeout = std::chrono::milliseconds{1000};
-		while (!terminated) {
-			io_context.run_for(timeout);
-		}
+		auto run_io = [&io_context, timeout]() {
+			while (!terminated) {
+				io_context.run_for(timeout);
+			}
+		};
+
+		std::vector<std::thread> io_threads;
+		for (long i = 1; i < server.config.io_threads; i++)
+			io_threads.emplace_back(run_io);
+		run_io();
+		for (auto &thread : io_threads)
+			thread.join();
+		if (prepare_thread.joinable())
+			prepare_thread.join();
+		if (prepare_failed)
+			return 1;
 
 		// cleanup
 		servers.clear();
@@ -6,11 +6,9 @@
 #define ONNXRUNTIME_SERVER_MODEL_BIN_GETTER_HPP
 
 #include "../onnxruntime_server.hpp"
-#include <fstream>
-#include <sstream>
 
 namespace onnxruntime_server {
-	std::string get_model_bin(const boost::filesystem::path &model_root, const std::string &model_name, const std::string &model_version) {
+	onnx::model_bin get_model_bin(const boost::filesystem::path &model_root, const std::string &model_name, const std::string &model_version) {
 		auto model_path = (model_root / model_name / model_version / "model.onnx").string();
 		//check model path exists
 		if (!std::filesystem::exists(model_path)) {
@@ -22,10 +20,8 @@ namespace onnxruntime_server {
 			}
 		}
 
-		std::ifstream file(model_path, std::ios::binary);
-		std::stringstream buffer;
-		buffer << file.rdbuf();
-		return buffer.str();
+		// mapped instead of read so that the model is not copied through user space before ONNX Runtime parses it
+		return onnx::model_bin::map_file(model_path);
 	}
 }
 
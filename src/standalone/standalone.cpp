@@ -17,6 +17,47 @@ int onnxruntime_server::standalone::init_config(int argc, char **argv) {
 			"workers", po::value<long>()->default_value(4),
 			"env: ONNX_SERVER_WORKERS\nWorker thread pool size.\nDefault: 4"
 		);
+		po_desc.add_options()(
+			"max-queue-depth", po::value<long>()->default_value(0),
+			"env: ONNX_SERVER_MAX_QUEUE_DEPTH\nMaximum number of requests waiting for a worker. Requests beyond it are "
+			"rejected with 503(HTTP) or service_unavailable_error(TCP).\nDefault: 0(unlimited)"
+		);
+		po_desc.add_options()(
+			"max-queue-wait-ms", po::value<long>()->default_value(0),
+			"env: ONNX_SERVER_MAX_QUEUE_WAIT_MS\nReject requests when the estimated wait for a worker exceeds this many "
+			"milliseconds. The estimate comes from the average run time of recent requests.\nDefault: 0(unlimited)"
+		);
+		po_desc.add_options()(
+			"worker-cpus", po::value<std::string>()->default_value(""),
+			"env: ONNX_SERVER_WORKER_CPUS\nPin worker threads to these CPUs, one CPU per worker in order. e.g. "
+			"\"0-15,32-47\"\nRequests for sessions with the numa_node option run on the workers of that node.\n"
+			"Default: empty(not pinned)"
+		);
+		po_desc.add_options()(
+			"io-threads", po::value<long>()->default_value(1),
+			"env: ONNX_SERVER_IO_THREADS\nNumber of threads handling network I/O. Requests run on the worker thread "
+			"pool.\nDefault: 1"
+		);
+		po_desc.add_options()(
+			"loader-threads", po::value<long>()->default_value(1),
+			"env: ONNX_SERVER_LOADER_THREADS\nNumber of threads loading models. Loading never blocks requests to "
+			"sessions that are already loaded.\nDefault: 1"
+		);
+		po_desc.add_options()(
+			"global-thread-pool", po::value<bool>()->default_value(true),
+			"env: ONNX_SERVER_GLOBAL_THREAD_POOL\nShare one set of ONNX Runtime intra/inter-op thread pools across all "
+			"sessions.\nA session can opt out with the \"global_thread_pool\": false option.\nDefault: true"
+		);
+		po_desc.add_options()(
+			"intra-op-threads", po::value<long>()->default_value(0),
+			"env: ONNX_SERVER_INTRA_OP_THREADS\nSize of the global intra-op thread pool.\nDefault: 0(number of "
+			"physical cores)"
+		);
+		po_desc.add_options()(
+			"inter-op-threads", po::value<long>()->default_value(0),
+			"env: ONNX_SERVER_INTER_OP_THREADS\nSize of the global inter-op thread pool.\nDefault: 0(ONNX Runtime "
+			"default)"
+		);
 		po_desc.add_options()(
 			"request-payload-limit", po::value<long>()->default_value(1024 * 1024 * 10),
 			"env: ONNX_SERVER_REQUEST_PAYLOAD_LIMIT\nHTTP/HTTPS request payload size limit.\nDefault: 1024 * 1024 * "
@@ -29,6 +70,12 @@ int onnxruntime_server::standalone::init_config(int argc, char **argv) {
 			"\"${model_dir}/${model_name}/${model_version}/model.onnx\" or "
 			"\n\"${model_dir}/${model_name}/${model_version}.onnx\"\nDefault: ./models"
 		);
+		po_desc.add_options()(
+			"model-cache-dir", po::value<std::string>(),
+			"env: ONNX_SERVER_MODEL_CACHE_DIR\nDirectory for optimized models. The graph optimized on the first load "
+			"of a model is saved here and loaded on later starts.\nThe cache is keyed by the model file, the ONNX "
+			"Runtime version and the session options.\nDefault: none(disabled)"
+		);
 		po_desc.add_options()(
 			"prepare-model", po::value<std::string>(),
 			"env: ONNX_SERVER_PREPARE_MODEL\nPre-create some model sessions at server startup.\n\n"
@@ -37,8 +84,27 @@ int onnxruntime_server::standalone::init_config(int argc, char **argv) {
 			"\n"
 			"Available session_options are\n"
 			"  - cuda=device_id[ or true or false]\n"
+			"  - batching=true or false, max_batch_size=N, max_queue_delay_us=N\n"
+			"  - result_cache=true or false, cache_max_bytes=N, cache_ttl_ms=N (answer repeated inputs from a cache)\n"
+			"  - intra=N, inter=N (per-session thread pools)\n"
+			"  - mode=sequential or parallel, opt=disable, basic, extended or all\n"
+			"  - arena=true or false, mem_pattern=true or false, spin=true or false\n"
+			"  - global_thread_pool=true or false\n"
+			"  - share=true or false (share prepacked weights with other sessions)\n"
+			"  - replicas=N, pin=true or false (N sessions of the model, optionally pinned to their own cores)\n"
+			"  - io_binding=true or false (reuse output buffers between executions)\n"
+			"  - float_precision=N (significant digits of float outputs in JSON)\n"
+			"  - timeout_ms=N (default request deadline in milliseconds, 0 for none)\n"
+			"  - priority=high, normal or low (worker queue lane of execute requests)\n"
+			"  - numa_node=N (weights and intra-op threads on NUMA node N)\n"
 			"\n"
-			"eg) \"model1:v1 model2:v9\"\n    \"model1:v1(cuda=true) model2:v9(cuda=0) model2:v13(cuda=1)\""
+			"eg) \"model1:v1 model2:v9\"\n    \"model1:v1(cuda=true) model2:v9(cuda=0) model2:v13(cuda=1)\"\n"
+			"    \"model1:v1(intra=2, opt=all)\""
+		);
+		po_desc.add_options()(
+			"prepare-model-background", po::value<bool>()->default_value(false),
+			"env: ONNX_SERVER_PREPARE_MODEL_BACKGROUND\nOpen the listeners before the prepared models are loaded. The "
+			"health check answers 503 until all of them are loaded.\nDefault: false"
 		);
 
 		po::options_description po_tcp("TCP Backend");
@@ -162,6 +228,30 @@ int onnxruntime_server::standalone::init_config(int argc, char **argv) {
 		if (vm.count("workers"))
 			config.num_threads = vm["workers"].as<long>();
 
+		if (vm.count("max-queue-depth"))
+			config.max_queue_depth = vm["max-queue-depth"].as<long>();
+
+		if (vm.count("max-queue-wait-ms"))
+			config.max_queue_wait_ms = vm["max-queue-wait-ms"].as<long>();
+
+		if (vm.count("worker-cpus"))
+			config.worker_cpus = vm["worker-cpus"].as<std::string>();
+
+		if (vm.count("io-threads"))
+			config.io_threads = vm["io-threads"].as<long>();
+
+		if (vm.count("loader-threads"))
+			config.loader_threads = vm["loader-threads"].as<long>();
+
+		if (vm.count("global-thread-pool"))
+			config.global_thread_pool = vm["global-thread-pool"].as<bool>();
+
+		if (vm.count("intra-op-threads"))
+			config.intra_op_threads = vm["intra-op-threads"].as<long>();
+
+		if (vm.count("inter-op-threads"))
+			config.inter_op_threads = vm["inter-op-threads"].as<long>();
+
 		if (vm.count("request-payload-limit"))
 			config.request_payload_limit = vm["request-payload-limit"].as<long>();
 
@@ -170,9 +260,15 @@ int onnxruntime_server::standalone::init_config(int argc, char **argv) {
 		else
 			config.model_dir = "models";
 
+		if (vm.count("model-cache-dir"))
+			config.model_cache_dir = vm["model-cache-dir"].as<std::string>();
+
 		if (vm.count("prepare-model"))
 			config.prepare_model = vm["prepare-model"].as<std::string>();
 
+		if (vm.count("prepare-model-background"))
+			config.prepare_model_background = vm["prepare-model-background"].as<bool>();
+
 		if (vm.count("tcp-port")) {
 			config.use_tcp = true;
 			config.tcp_port = vm["tcp-port"].as<short>();
@@ -246,16 +342,50 @@ void onnxruntime_server::standalone::prepare_models(onnxruntime_server::onnx::se
 	if (model_keys.empty())
 		return;
 
+	// every model is scheduled at once; the loader pool bounds how many load in parallel
+	auto started_at = std::chrono::steady_clock::now();
+	std::vector<Orts::onnx::session_manager::session_future_t> loads;
 	for (auto &key : model_keys) {
-		manager.create_session(key.model_name, key.model_version, key.option);
+		loads.emplace_back(manager.load_session(key.model_name, key.model_version, key.option));
+	}
+
+	std::string error;
+	for (size_t i = 0; i < loads.size(); i++) {
+		try {
+			loads[i].get();
+		} catch (std::exception &e) {
+			if (error.empty())
+				error = model_keys[i].model_name + ":" + model_keys[i].model_version + ": " + e.what();
+		}
 	}
+
+	PLOG(L_INFO) << "Prepared " << loads.size() << " models in "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started_at)
+						.count()
+				 << "ms" << std::endl;
+	if (!error.empty())
+		throw std::runtime_error(error);
 }
 
 void onnxruntime_server::standalone::print_config() {
 	// print config values
 	auto config_json = ordered_json::object();
 	config_json["workers"] = config.num_threads;
+	config_json["max_queue_depth"] = config.max_queue_depth;
+	config_json["max_queue_wait_ms"] = config.max_queue_wait_ms;
+	if (!config.worker_cpus.empty())
+		config_json["worker_cpus"] = config.worker_cpus;
+	config_json["io_threads"] = config.io_threads;
+	config_json["loader_threads"] = config.loader_threads;
+	config_json["global_thread_pool"] = json::object();
+	config_json["global_thread_pool"]["use"] = config.global_thread_pool;
+	if (config.global_thread_pool) {
+		config_json["global_thread_pool"]["intra_op_threads"] = config.intra_op_threads;
+		config_json["global_thread_pool"]["inter_op_threads"] = config.inter_op_threads;
+	}
 	config_json["model_dir"] = config.model_dir;
+	config_json["model_cache_dir"] = config.model_cache_dir;
+	config_json["prepare_model_background"] = config.prepare_model_background;
 
 	config_json["tcp"] = json::object();
 	config_json["tcp"]["use"] = config.use_tcp;
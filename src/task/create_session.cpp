@@ -21,6 +21,7 @@ Orts::task::create_session::create_session(
 	: session_task(onnx_session_manager, request_json), model_data(model_data), model_data_length(model_data_length) {
 	option =
 		request_json.contains("option") && request_json["option"].is_object() ? request_json["option"] : json::object();
+	async = request_json.contains("async") && request_json["async"].is_boolean() && request_json["async"].get<bool>();
 }
 
 Orts::task::create_session::create_session(
@@ -32,6 +33,16 @@ Orts::task::create_session::create_session(
 }
 
 json Orts::task::create_session::run() {
+	if (async) {
+		auto result = onnx_session_manager.load_session(
+			model_name, model_version, option, model_data, model_data_length
+		);
+		auto loading = onnx_session_manager.get_loading_session(onnx::session_key(model_name, model_version));
+		if (loading.has_value())
+			return loading->to_json();
+		return result.get()->to_json();
+	}
+
 	std::shared_ptr<Orts::onnx::session> session =
 		onnx_session_manager.create_session(model_name, model_version, option, model_data, model_data_length);
 	if (session == nullptr) {
@@ -40,3 +51,24 @@ json Orts::task::create_session::run() {
 
 	return session->to_json();
 }
+
+void Orts::task::create_session::run(const std::function<void(json result, std::exception_ptr error)> &done) {
+	json res;
+	try {
+		if (!async) {
+			onnx_session_manager.create_session(
+				model_name, model_version, option, model_data, model_data_length,
+				[done](std::shared_ptr<onnx::session> session, std::exception_ptr error) {
+					if (error != nullptr)
+						return done(json(), error);
+					done(session->to_json(), nullptr);
+				}
+			);
+			return;
+		}
+		res = run();
+	} catch (...) {
+		return done(json(), std::current_exception());
+	}
+	done(std::move(res), nullptr);
+}
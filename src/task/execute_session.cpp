@@ -8,12 +8,50 @@ std::string onnxruntime_server::task::execute_session::name() {
 	return "EXECUTE_SESSION";
 }
 
+#define EXECUTE_SESSION_DATA_KEY "data"
+
+static long request_timeout_ms(const json &request_json) {
+	if (!request_json.contains("timeout_ms"))
+		return 0;
+	if (!request_json["timeout_ms"].is_number_integer() || request_json["timeout_ms"].get<long>() < 0)
+		throw Orts::bad_request_error("Invalid session task. timeout_ms must be a non-negative integer");
+	return request_json["timeout_ms"].get<long>();
+}
+
+// the fields of a request next to its inputs. the inputs themselves are only skipped here
+static json request_envelope(const char *payload, size_t length, Orts::onnx::execution::payload_format format) {
+	std::vector<Orts::onnx::value_info> none;
+	Orts::onnx::execution::json_sax_decoder decoder(none, EXECUTE_SESSION_DATA_KEY);
+	decoder.parse(payload, length, format);
+	if (!decoder.root_found)
+		throw Orts::bad_request_error("Invalid session task. Must be a JSON object with data(object) field");
+	return std::move(decoder.fields);
+}
+
 Orts::task::execute_session::execute_session(onnx::session_manager &onnx_session_manager, const json &request_json)
 	: session_task(onnx_session_manager, request_json) {
 	if (!request_json.is_object() || !request_json.contains("data") || !request_json["data"].is_object()) {
 		throw bad_request_error("Invalid session task. Must be a JSON object with data(object) field");
 	}
 	data = request_json["data"];
+	timeout_ms = request_timeout_ms(request_json);
+}
+
+Orts::task::execute_session::execute_session(
+	onnx::session_manager &onnx_session_manager, const char *payload, size_t payload_length,
+	onnx::execution::payload_format format
+)
+	: execute_session(onnx_session_manager, request_envelope(payload, payload_length, format), payload, payload_length,
+					  format) {
+}
+
+Orts::task::execute_session::execute_session(
+	onnx::session_manager &onnx_session_manager, const json &envelope, const char *payload, size_t payload_length,
+	onnx::execution::payload_format format
+)
+	: session_task(onnx_session_manager, envelope), payload_root(EXECUTE_SESSION_DATA_KEY), payload(payload),
+	  payload_length(payload_length), format(format) {
+	timeout_ms = request_timeout_ms(envelope);
 }
 
 Orts::task::execute_session::execute_session(
@@ -23,15 +61,199 @@ Orts::task::execute_session::execute_session(
 	: session_task(onnx_session_manager, model_name, model_version), data(std::move(data)) {
 }
 
-json Orts::task::execute_session::run() {
+Orts::task::execute_session::execute_session(
+	onnx::session_manager &onnx_session_manager, const std::string &model_name, const std::string &model_version,
+	const char *payload, size_t payload_length, onnx::execution::payload_format format
+)
+	: session_task(onnx_session_manager, model_name, model_version), payload(payload), payload_length(payload_length),
+	  format(format) {
+}
+
+std::shared_ptr<Orts::onnx::session> Orts::task::execute_session::get_session() {
 	auto session = onnx_session_manager.get_session(model_name, model_version);
 	if (session == nullptr) {
 		throw not_found_error("session not found");
 	}
+	// skip decoding the inputs of a request that waited in the worker queue past its deadline
+	if (onnx::run_watchdog::expired(deadline(session)))
+		throw gateway_timeout_error("Deadline exceeded while queued");
 	session->touch();
+	return session;
+}
+
+std::unique_ptr<Orts::onnx::execution::context>
+Orts::task::execute_session::create_context(std::shared_ptr<onnx::session> session) {
+	if (payload != nullptr)
+		return std::make_unique<onnx::execution::context>(session, payload, payload_length, format, payload_root);
+	return std::make_unique<onnx::execution::context>(session, data);
+}
+
+Orts::onnx::deadline_t Orts::task::execute_session::deadline(const std::shared_ptr<onnx::session> &session) const {
+	auto timeout = timeout_ms > 0 ? timeout_ms : session->timeout_ms();
+	if (timeout <= 0)
+		return onnx::deadline_t::max();
+	return received_at + std::chrono::milliseconds(timeout);
+}
+
+void Orts::task::execute_session::execute(
+	const std::shared_ptr<onnx::session> &session, onnx::execution::context &ctx,
+	const std::function<void(std::vector<Ort::Value> &)> &consume
+) {
+	// outputs may view buffers that the next run on the same thread reuses, so they are consumed on the running thread
+	auto deadline = this->deadline(session);
+	auto run = [&ctx, &consume, deadline]() {
+		// requests that expired while queued are dropped without running the model
+		if (onnx::run_watchdog::expired(deadline))
+			throw gateway_timeout_error("Deadline exceeded while queued");
+		auto result = ctx.run(deadline);
+		consume(result);
+	};
+
+	// batching sessions run on their own batch scheduler thread, so requests must not occupy the worker pool while
+	// they wait to be merged. requests already handled on a worker (async HTTP, tagged TCP) run in place.
+	if (session->batching() || onnx_session_manager.thread_pool.is_worker_thread())
+		return run();
+	auto placement = this->placement(session);
+	// a connection thread that would only wait for the result runs the model itself while a worker is idle, unless
+	// the session is placed on a NUMA node, whose pinned workers run it
+	if (onnx_session_manager.thread_pool.try_run_here(placement, run))
+		return;
+	onnx_session_manager.thread_pool.enqueue(placement, run).get();
+}
+
+Orts::task_placement Orts::task::execute_session::placement() {
+	auto session = onnx_session_manager.get_session(model_name, model_version);
+	if (session == nullptr)
+		return priority.value_or(task_priority::normal);
+	return placement(session);
+}
+
+Orts::task_placement Orts::task::execute_session::placement(const std::shared_ptr<onnx::session> &session) const {
+	auto placement = session->placement();
+	if (priority)
+		placement.priority = *priority;
+	return placement;
+}
+
+std::optional<uint64_t> Orts::task::execute_session::cache_key(
+	const std::shared_ptr<onnx::session> &session, const onnx::execution::context &ctx, int format
+) {
+	if (session->cache() == nullptr)
+		return std::nullopt;
+	auto key = ctx.input_hash();
+	if (!key.has_value())
+		return std::nullopt;
+	// the same inputs answered in another format are another entry
+	return onnx::result_cache::hash(&format, sizeof(format), *key);
+}
+
+json Orts::task::execute_session::run() {
+	auto session = get_session();
+	auto ctx = create_context(session);
+
+	// cached as msgpack, apart from the payload formats
+	auto key = cache_key(session, *ctx, -1);
+	if (key.has_value()) {
+		auto cached = session->cache()->get(*key);
+		if (cached.has_value())
+			return json::from_msgpack(*cached);
+	}
+
+	json res;
+	execute(session, *ctx, [&ctx, &res](std::vector<Ort::Value> &result) { res = ctx->tensors_to_json(result); });
+	if (key.has_value()) {
+		std::string packed;
+		json::to_msgpack(res, packed);
+		session->cache()->put(*key, std::move(packed));
+	}
+	return res;
+}
+
+void Orts::task::execute_session::check_accept(
+	const std::shared_ptr<onnx::session> &session, onnx::execution::payload_format accept
+) {
+	if (accept != onnx::execution::PAYLOAD_TENSOR)
+		return;
+	// fail before running the model if an output cannot be written as raw bytes
+	for (auto &output : session->outputs()) {
+		if (onnx::value_info::element_size(output.element_type) == 0)
+			throw bad_request_error(
+				"Output " + output.name + " type " + output.type_name() + " is not supported in tensor payload"
+			);
+	}
+}
+
+std::string Orts::task::execute_session::run(onnx::execution::payload_format accept) {
+	return run(get_session(), accept);
+}
+
+std::string Orts::task::execute_session::run(
+	const std::shared_ptr<onnx::session> &session, onnx::execution::payload_format accept
+) {
+	check_accept(session, accept);
+	auto ctx = create_context(session);
+	auto key = cache_key(session, *ctx, accept);
+	if (key.has_value()) {
+		auto cached = session->cache()->get(*key);
+		if (cached.has_value())
+			return std::move(*cached);
+	}
+
+	std::string res;
+	execute(session, *ctx, [&ctx, &res, accept](std::vector<Ort::Value> &result) {
+		res = ctx->tensors_to_payload(result, accept);
+	});
+	if (key.has_value())
+		session->cache()->put(*key, res);
+	return res;
+}
+
+void Orts::task::execute_session::run(onnx::execution::payload_format accept, const completion_t &done) {
+	std::string res;
+	try {
+		auto session = get_session();
+		// only batching sessions wait for other requests. the rest run on this thread as usual
+		if (!session->batching()) {
+			res = run(session, accept);
+		} else {
+			check_accept(session, accept);
+			std::shared_ptr<onnx::execution::context> ctx = create_context(session);
+			auto key = cache_key(session, *ctx, accept);
+			auto cached = key.has_value() ? session->cache()->get(*key) : std::nullopt;
+			if (!cached.has_value())
+				return submit(session, ctx, key, accept, done);
+			res = std::move(*cached);
+		}
+	} catch (...) {
+		return done({}, std::current_exception());
+	}
+	done(std::move(res), nullptr);
+}
+
+void Orts::task::execute_session::submit(
+	std::shared_ptr<onnx::session> session, std::shared_ptr<onnx::execution::context> ctx,
+	std::optional<uint64_t> key, onnx::execution::payload_format accept, const completion_t &done
+) {
+	auto &manager = onnx_session_manager;
+	auto deadline = this->deadline(session);
+	ctx->run(
+		deadline,
+		[&manager, session, ctx, key, accept, done](std::vector<Ort::Value> &outputs, std::exception_ptr error) mutable {
+			std::string res;
+			if (error == nullptr) {
+				try {
+					res = ctx->tensors_to_payload(outputs, accept);
+					if (key.has_value())
+						session->cache()->put(*key, res);
+				} catch (...) {
+					error = std::current_exception();
+				}
+			}
+			done(std::move(res), error);
 
-	Orts::onnx::execution::context ctx(session, data);
-	auto result = onnx_session_manager.thread_pool.enqueue([&ctx]() { return ctx.run(); }).get();
-	// auto result = ctx.run();
-	return ctx.tensors_to_json(result);
+			// the session may have been removed meanwhile, and its destructor joins the batch scheduler thread this
+			// runs on. the last references are let go on the loader pool instead
+			manager.loader_pool.post(task_priority::normal, [session = std::move(session), ctx = std::move(ctx)]() {});
+		}
+	);
 }
@@ -23,6 +23,9 @@ Orts::task::get_session::get_session(
 json Orts::task::get_session::run() {
 	auto session = onnx_session_manager.get_session(model_name, model_version);
 	if (session == nullptr) {
+		auto loading = onnx_session_manager.get_loading_session(onnx::session_key::unchecked(model_name, model_version));
+		if (loading.has_value())
+			return loading->to_json();
 		throw not_found_error("session not found");
 	}
 
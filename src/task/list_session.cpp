@@ -19,6 +19,9 @@ json Orts::task::list_session::run() {
 	for (auto &it : sessions) {
 		session_list.emplace_back(it.second->to_json());
 	}
+	for (auto &loading : onnx_session_manager.get_loading_sessions()) {
+		session_list.emplace_back(loading.to_json());
+	}
 
 	return session_list;
 }
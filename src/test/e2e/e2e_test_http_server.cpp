@@ -30,6 +30,14 @@ TEST(test_onnxruntime_server_http, HttpServerTest) {
 		ASSERT_EQ(boost::beast::buffers_to_string(res.body().data()), "OK");
 	}
 
+	{ // health check while prepared models are loading
+		manager.set_ready(false);
+		auto res = http_request(boost::beast::http::verb::get, "/health", server.port(), "");
+		manager.set_ready(true);
+		ASSERT_EQ(res.result(), boost::beast::http::status::service_unavailable);
+		ASSERT_EQ(boost::beast::buffers_to_string(res.body().data()), "Not Ready");
+	}
+
 	{ // not found
 		TIME_MEASURE_START
 		auto res = http_request(boost::beast::http::verb::get, "/not-exists-path", server.port(), "");
@@ -39,15 +47,23 @@ TEST(test_onnxruntime_server_http, HttpServerTest) {
 	}
 
 	{ // API: Create session
+		// every worker is busy. loading the model must not need one of them
+		std::promise<void> release;
+		auto released = release.get_future().share();
+		for (long i = 0; i < config.num_threads; i++)
+			manager.thread_pool.post(Orts::task_priority::normal, [released]() { released.wait(); });
+
 		json body = json::parse(R"({"model":"sample","version":"1"})");
 		TIME_MEASURE_START
 		auto res = http_request(boost::beast::http::verb::post, "/api/sessions", server.port(), body.dump());
 		TIME_MEASURE_STOP
+		release.set_value();
 		ASSERT_EQ(res.result(), boost::beast::http::status::ok);
 		json res_json = json::parse(boost::beast::buffers_to_string(res.body().data()));
 		std::cout << "API: Create session\n" << res_json.dump(2) << "\n";
 		ASSERT_EQ(res_json["model"], "sample");
 		ASSERT_EQ(res_json["version"], "1");
+		ASSERT_TRUE(res_json["option"]["global_thread_pool"]);
 	}
 
 	{ // API: Get session
@@ -129,6 +145,30 @@ TEST(test_onnxruntime_server_http, HttpServerTest) {
 		ASSERT_EQ(res_json.size(), 0);
 	}
 
+	{ // API: Create session asynchronously
+		json body = json::parse(R"({"model":"sample","version":"1","async":true})");
+		TIME_MEASURE_START
+		auto res = http_request(boost::beast::http::verb::post, "/api/sessions", server.port(), body.dump());
+		TIME_MEASURE_STOP
+		ASSERT_EQ(res.result(), boost::beast::http::status::accepted);
+		json res_json = json::parse(boost::beast::buffers_to_string(res.body().data()));
+		std::cout << "API: Create session asynchronously\n" << res_json.dump(2) << "\n";
+		ASSERT_EQ(res_json["model"], "sample");
+		ASSERT_EQ(res_json["version"], "1");
+
+		// poll until the loader publishes the session
+		for (int i = 0; i < 100 && res_json["state"] != "ready"; i++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			res = http_request(boost::beast::http::verb::get, "/api/sessions/sample/1", server.port(), "");
+			ASSERT_EQ(res.result(), boost::beast::http::status::ok);
+			res_json = json::parse(boost::beast::buffers_to_string(res.body().data()));
+		}
+		ASSERT_EQ(res_json["state"], "ready");
+
+		res = http_request(boost::beast::http::verb::post, "/api/sessions", server.port(), body.dump());
+		ASSERT_EQ(res.result(), boost::beast::http::status::conflict);
+	}
+
 	running = false;
 	server_thread.join();
 }
@@ -195,6 +235,15 @@ TEST(test_onnxruntime_server_http, HttpServerTest3) {
 		ASSERT_GT(res_json["output"][0], 0);
 	}
 
+	{ // API: Worker queue statistics
+		auto res = http_request(boost::beast::http::verb::get, "/api/stats", server.port(), "");
+		ASSERT_EQ(res.result(), boost::beast::http::status::ok);
+		json res_json = json::parse(boost::beast::buffers_to_string(res.body().data()));
+		std::cout << "API: Stats\n" << res_json.dump(2) << "\n";
+		ASSERT_EQ(res_json["workers"]["threads"], config.num_threads);
+		ASSERT_EQ(res_json["workers"]["rejected"], 0);
+	}
+
 	{ // API: Destroy session
 		TIME_MEASURE_START
 		auto res = http_request(boost::beast::http::verb::delete_, "/api/sessions/sample/3", server.port(), "");
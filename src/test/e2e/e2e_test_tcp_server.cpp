@@ -13,7 +13,9 @@ json tcp_request(
 	boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), port);
 	socket.connect(endpoint);
 
-	auto json_data = json.dump();
+	auto format = (type & TCP_TYPE_FORMAT_MASK) == TCP_TYPE_FORMAT_MSGPACK ? Orts::onnx::execution::PAYLOAD_MSGPACK
+																			: Orts::onnx::execution::PAYLOAD_JSON;
+	auto json_data = Orts::onnx::execution::encode_payload(json, format);
 	struct onnxruntime_server::transport::tcp::protocol_header header = {};
 	header.type = htons(type);
 	header.length = HTONLL(json_data.size() + post_size);
@@ -51,7 +53,9 @@ json tcp_request(
 		buffer.append(chunk.data(), length);
 	}
 
-	return json::parse(buffer);
+	if (res_header.type == -1)
+		return json::parse(buffer);
+	return Orts::onnx::execution::decode_payload(buffer.data(), buffer.size(), format);
 }
 
 TEST(test_onnxruntime_server_tcp, TcpServerTest) {
@@ -139,6 +143,18 @@ TEST(test_onnxruntime_server_tcp, TcpServerTest) {
 		ASSERT_GT(res_json["output"][0], 0);
 	}
 
+	{ // API: Execute session with MessagePack
+		auto input = json::parse(R"({"model":"sample","version":"1","data":{"x":[[1]],"y":[[2]],"z":[[3]]}})");
+		TIME_MEASURE_START
+		auto res_json =
+			tcp_request(server.port(), Orts::task::type::EXECUTE_SESSION | TCP_TYPE_FORMAT_MSGPACK, input);
+		TIME_MEASURE_STOP
+		std::cout << "API: Execute sessions with MessagePack\n" << res_json.dump(2) << "\n";
+		ASSERT_TRUE(res_json.contains("output"));
+		ASSERT_EQ(res_json["output"].size(), 1);
+		ASSERT_GT(res_json["output"][0], 0);
+	}
+
 	{ // API: Destroy session
 		json body = json::parse(R"({"model":"sample","version":"1"})");
 		TIME_MEASURE_START
@@ -159,3 +175,132 @@ TEST(test_onnxruntime_server_tcp, TcpServerTest) {
 	running = false;
 	server_thread.join();
 }
+
+TEST(test_onnxruntime_server_tcp, TcpMultiplexedTest) {
+	Orts::config config;
+	config.model_bin_getter = test_model_bin_getter;
+
+	boost::asio::io_context io_context;
+	Orts::onnx::session_manager manager(config.model_bin_getter, config.num_threads);
+	Orts::transport::tcp::tcp_server server(io_context, config, manager);
+	manager.create_session("sample", "1", json::object());
+
+	bool running = true;
+	std::thread server_thread([&io_context, &running]() { test_server_run(io_context, &running); });
+
+	boost::asio::io_context client_context;
+	boost::asio::ip::tcp::socket socket(client_context);
+	socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), server.port()));
+
+	// pipeline tagged requests on one connection, including one that fails
+	std::map<int64_t, json> requests;
+	for (int64_t id = 1; id <= 8; id++) {
+		auto body = json::parse(R"({"model":"sample","version":"1","data":{"x":[[1]],"y":[[2]],"z":[[3]]}})");
+		body["data"]["x"][0][0] = id;
+		if (id == 8)
+			body["version"] = "not-exists";
+		requests[id] = body;
+
+		auto json_data = body.dump();
+		Orts::transport::tcp::protocol_header header = {};
+		header.type = htons(Orts::task::type::EXECUTE_SESSION | TCP_TYPE_FLAG_REQUEST_ID);
+		header.length = HTONLL(json_data.size());
+		header.json_length = HTONLL(json_data.size());
+		header.post_length = 0;
+		int64_t request_id = HTONLL(id);
+
+		std::vector<boost::asio::const_buffer> buffers;
+		buffers.emplace_back(&header, sizeof(header));
+		buffers.emplace_back(&request_id, sizeof(request_id));
+		buffers.emplace_back(json_data.c_str(), json_data.size());
+		boost::asio::write(socket, buffers);
+	}
+
+	std::set<int64_t> answered;
+	for (size_t i = 0; i < requests.size(); i++) {
+		Orts::transport::tcp::protocol_header res_header = {};
+		int64_t request_id = 0;
+		boost::asio::read(socket, boost::asio::buffer(&res_header, sizeof(res_header)));
+		boost::asio::read(socket, boost::asio::buffer(&request_id, sizeof(request_id)));
+		res_header.type = ntohs(res_header.type);
+		request_id = NTOHLL(request_id);
+
+		std::string buffer(NTOHLL(res_header.length), '\0');
+		boost::asio::read(socket, boost::asio::buffer(buffer.data(), buffer.size()));
+		auto res_json = json::parse(buffer);
+		std::cout << "Response " << request_id << ": " << res_json.dump() << "\n";
+
+		ASSERT_TRUE(requests.count(request_id));
+		ASSERT_FALSE(answered.count(request_id));
+		answered.insert(request_id);
+
+		if (request_id == 8) {
+			ASSERT_EQ(res_header.type, TCP_TYPE_TAGGED_ERROR);
+			ASSERT_TRUE(res_json.contains("error"));
+		} else {
+			ASSERT_EQ(res_header.type, Orts::task::type::EXECUTE_SESSION | TCP_TYPE_FLAG_REQUEST_ID);
+			ASSERT_EQ(res_json["output"].size(), 1);
+		}
+	}
+	ASSERT_EQ(answered.size(), requests.size());
+
+	socket.close();
+	running = false;
+	server_thread.join();
+}
+
+TEST(test_onnxruntime_server_tcp, TcpTimeoutTest) {
+	Orts::config config;
+	config.model_bin_getter = test_model_bin_getter;
+
+	boost::asio::io_context io_context;
+	Orts::onnx::session_manager manager(config.model_bin_getter, config.num_threads);
+	Orts::transport::tcp::tcp_server server(io_context, config, manager);
+	// a lone request waits out the queue delay for more rows, which is longer than the short timeout below
+	manager.create_session(
+		"sample", "1", json::parse(R"({"batching":{"max_batch_size":8,"max_queue_delay_us":500000}})")
+	);
+
+	bool running = true;
+	std::thread server_thread([&io_context, &running]() { test_server_run(io_context, &running); });
+
+	boost::asio::io_context client_context;
+	boost::asio::ip::tcp::socket socket(client_context);
+	socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), server.port()));
+
+	auto execute = [&socket](uint32_t timeout_ms) {
+		auto json_data = std::string(R"({"model":"sample","version":"1","data":{"x":[[1]],"y":[[2]],"z":[[3]]}})");
+		Orts::transport::tcp::protocol_header header = {};
+		header.type = htons(Orts::task::type::EXECUTE_SESSION | TCP_TYPE_FLAG_TIMEOUT);
+		header.length = HTONLL(json_data.size());
+		header.json_length = HTONLL(json_data.size());
+		header.post_length = 0;
+		uint32_t timeout = htonl(timeout_ms);
+
+		std::vector<boost::asio::const_buffer> buffers;
+		buffers.emplace_back(&header, sizeof(header));
+		buffers.emplace_back(&timeout, sizeof(timeout));
+		buffers.emplace_back(json_data.c_str(), json_data.size());
+		boost::asio::write(socket, buffers);
+
+		Orts::transport::tcp::protocol_header res_header = {};
+		boost::asio::read(socket, boost::asio::buffer(&res_header, sizeof(res_header)));
+		std::string buffer(NTOHLL(res_header.length), '\0');
+		boost::asio::read(socket, boost::asio::buffer(buffer.data(), buffer.size()));
+		return std::make_pair((int16_t)ntohs(res_header.type), json::parse(buffer));
+	};
+
+	auto expired = execute(20);
+	std::cout << expired.second.dump() << "\n";
+	ASSERT_EQ(expired.first, -1);
+	ASSERT_EQ(expired.second["error_type"], "gateway_timeout_error");
+
+	// the flag is not echoed, and the connection is still in step after the extra header field
+	auto answered = execute(10000);
+	ASSERT_EQ(answered.first, Orts::task::type::EXECUTE_SESSION);
+	ASSERT_EQ(answered.second["output"].size(), 1);
+
+	socket.close();
+	running = false;
+	server_thread.join();
+}
@@ -22,7 +22,7 @@ boost::filesystem::path model_root = test_dir / "fixture";
 auto model1_path = model_root / "sample" / "1" / "model.onnx";
 auto model2_path = model_root / "sample" / "2" / "model.onnx";
 
-std::string test_model_bin_getter(const std::string &model_name, const std::string &model_version) {
+onnxruntime_server::onnx::model_bin test_model_bin_getter(const std::string &model_name, const std::string &model_version) {
 	return onnxruntime_server::get_model_bin(model_root.string(), model_name, model_version);
 }
 
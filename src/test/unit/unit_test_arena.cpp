@@ -0,0 +1,100 @@
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+using arena = Orts::onnx::execution::arena;
+
+TEST(unit_test_arena, Allocate) {
+	arena a;
+	auto *c = static_cast<char *>(a.allocate(1, 1));
+	auto *d = a.allocate<double>(3);
+	ASSERT_NE(c, nullptr);
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(d) % alignof(double), 0);
+	ASSERT_GE(a.used(), 1 + sizeof(double) * 3);
+	ASSERT_EQ(a.capacity(), arena::initial_chunk_size);
+
+	// larger than a chunk
+	auto *big = static_cast<char *>(a.allocate(arena::initial_chunk_size * 4, 64));
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(big) % 64, 0);
+	std::memset(big, 1, arena::initial_chunk_size * 4);
+	ASSERT_GT(a.capacity(), arena::initial_chunk_size * 4);
+
+	// chunks are merged on reset, so the same amount fits without growing
+	auto capacity = a.capacity();
+	a.reset();
+	ASSERT_EQ(a.used(), 0);
+	ASSERT_EQ(a.capacity(), capacity);
+	a.allocate(1, 1);
+	a.allocate(arena::initial_chunk_size * 4, 64);
+	ASSERT_EQ(a.capacity(), capacity);
+}
+
+TEST(unit_test_arena, Deallocate) {
+	arena a;
+	auto *first = a.allocate<int64_t>(4);
+	auto used = a.used();
+
+	// only the most recent allocation is given back
+	auto *second = a.allocate<int64_t>(4);
+	a.deallocate(first, sizeof(int64_t) * 4);
+	ASSERT_GT(a.used(), used);
+	a.deallocate(second, sizeof(int64_t) * 4);
+	ASSERT_EQ(a.used(), used);
+
+	arena::vector<int32_t> values{arena::allocator<int32_t>(a)};
+	for (int32_t i = 0; i < 10000; i++)
+		values.push_back(i);
+	for (int32_t i = 0; i < 10000; i++)
+		ASSERT_EQ(values[i], i);
+}
+
+TEST(unit_test_arena, Scope) {
+	arena a;
+	{
+		arena::scope outer(a);
+		a.allocate(100, 1);
+		{
+			arena::scope inner(a);
+			ASSERT_EQ(a.active(), 2);
+		}
+		// an inner scope must not rewind memory the outer one still uses
+		ASSERT_GE(a.used(), 100);
+	}
+	ASSERT_EQ(a.active(), 0);
+	ASSERT_EQ(a.used(), 0);
+}
+
+TEST(unit_test_arena, Pooled) {
+	arena *first;
+	{
+		auto a = arena::pooled();
+		first = a.get();
+		a->allocate(100, 1);
+	}
+
+	// the arena given back is handed out again, rewound
+	auto b = arena::pooled();
+	ASSERT_EQ(b.get(), first);
+	ASSERT_EQ(b->used(), 0);
+	ASSERT_EQ(b->capacity(), arena::initial_chunk_size);
+	auto c = arena::pooled();
+	ASSERT_NE(c.get(), first);
+}
+
+TEST(unit_test_arena, Context) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+	auto &local = arena::local();
+
+	{
+		Orts::onnx::execution::context ctx(session, R"({"x":[[1]],"y":[[2]],"z":[[3]]})");
+		ASSERT_EQ(local.active(), 1);
+		ASSERT_GT(local.used(), 0);
+
+		auto result = ctx.run();
+		auto output = ctx.tensors_to_json(result);
+		ASSERT_EQ(output["output"].size(), 1);
+		ASSERT_GT(output["output"][0], 0);
+	}
+	ASSERT_EQ(local.active(), 0);
+	ASSERT_EQ(local.used(), 0);
+}
@@ -0,0 +1,162 @@
+#include <cstring>
+
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+TEST(unit_test_batch_scheduler, ConcurrentRequestsTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+	auto batch_session = std::make_shared<Orts::onnx::session>(
+		key, model1_path.string(), json::parse(R"({"batching":{"max_batch_size":8,"max_queue_delay_us":20000}})")
+	);
+	ASSERT_TRUE(batch_session->batching());
+	std::cout << batch_session->to_json().dump(2) << "\n";
+
+	const int count = 8;
+	std::vector<json> expected(count);
+	std::vector<json> results(count);
+	std::vector<std::string> inputs(count);
+	for (int i = 0; i < count; i++) {
+		// requests with 1 or 2 rows
+		if (i % 2 == 0)
+			inputs[i] = "{\"x\":[[" + std::to_string(i) + "]],\"y\":[[2]],\"z\":[[3]]}";
+		else
+			inputs[i] = "{\"x\":[[" + std::to_string(i) + "],[1]],\"y\":[[2],[3]],\"z\":[[3],[4]]}";
+
+		Orts::onnx::execution::context ctx(session, inputs[i]);
+		auto result = ctx.run();
+		expected[i] = ctx.tensors_to_json(result);
+	}
+
+	TIME_MEASURE_INIT
+	TIME_MEASURE_START
+	std::vector<std::thread> threads;
+	for (int i = 0; i < count; i++) {
+		threads.emplace_back([&, i]() {
+			Orts::onnx::execution::context ctx(batch_session, inputs[i]);
+			auto result = ctx.run();
+			results[i] = ctx.tensors_to_json(result);
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	TIME_MEASURE_STOP
+
+	for (int i = 0; i < count; i++) {
+		std::cout << results[i].dump() << "\n";
+		ASSERT_EQ(results[i]["output"].size(), i % 2 == 0 ? 1 : 2);
+		for (size_t r = 0; r < results[i]["output"].size(); r++)
+			ASSERT_FLOAT_EQ(results[i]["output"][r][0].get<float>(), expected[i]["output"][r][0].get<float>());
+	}
+}
+
+TEST(unit_test_batch_scheduler, DisabledTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string(), json::parse(R"({"batching":false})"));
+	ASSERT_FALSE(session->batching());
+	ASSERT_FALSE(session->to_json()["option"]["batching"]);
+
+	for (auto invalid : {R"({"max_batch_size":"8"})", R"({"max_batch_size":0})", R"({"max_queue_delay_us":1.5})"}) {
+		json option = json::object({{"batching", json::parse(invalid)}});
+		ASSERT_THROW(Orts::onnx::session(key, model1_path.string(), option), Orts::bad_request_error);
+	}
+}
+
+TEST(unit_test_batch_scheduler, DeadlineTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto batch_session = std::make_shared<Orts::onnx::session>(
+		key, model1_path.string(), json::parse(R"({"batching":{"max_batch_size":8,"max_queue_delay_us":50000}})")
+	);
+	ASSERT_TRUE(batch_session->batching());
+
+	// the request expires while the scheduler still waits for more rows, so it is dropped instead of run
+	Orts::onnx::execution::context ctx(batch_session, R"({"x":[[1]],"y":[[2]],"z":[[3]]})");
+	ASSERT_THROW(ctx.run(std::chrono::steady_clock::now() + std::chrono::milliseconds(5)), Orts::gateway_timeout_error);
+
+	Orts::onnx::execution::context next_ctx(batch_session, R"({"x":[[1]],"y":[[2]],"z":[[3]]})");
+	auto result = next_ctx.run(std::chrono::steady_clock::now() + std::chrono::seconds(10));
+	ASSERT_GT(next_ctx.tensors_to_json(result)["output"][0], 0);
+}
+
+TEST(unit_test_batch_scheduler, AsyncRequestsTest) {
+	Orts::onnx::session_manager manager(test_model_bin_getter, 1);
+	manager.create_session(
+		"sample", "1", json::parse(R"({"batching":{"max_batch_size":8,"max_queue_delay_us":20000}})")
+	);
+
+	// every request is submitted from this thread, which would not get past the first one if it waited for the batch
+	const int count = 8;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<std::string> results(count);
+	int completed = 0;
+	for (int i = 0; i < count; i++) {
+		Orts::task::execute_session task(
+			manager, "sample", "1", json::parse("{\"x\":[[" + std::to_string(i) + "]],\"y\":[[2]],\"z\":[[3]]}")
+		);
+		task.run(Orts::onnx::execution::PAYLOAD_JSON, [&, i](std::string res, std::exception_ptr error) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (error == nullptr)
+				results[i] = std::move(res);
+			completed++;
+			condition.notify_one();
+		});
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(10), [&]() { return completed == count; }));
+	for (int i = 0; i < count; i++) {
+		Orts::task::execute_session task(
+			manager, "sample", "1", json::parse("{\"x\":[[" + std::to_string(i) + "]],\"y\":[[2]],\"z\":[[3]]}")
+		);
+		ASSERT_EQ(json::parse(results[i])["output"], task.run()["output"]);
+	}
+}
+
+TEST(unit_test_batch_scheduler, EmptyBatchTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto batch_session = std::make_shared<Orts::onnx::session>(
+		key, model1_path.string(), json::parse(R"({"batching":{"max_batch_size":8,"max_queue_delay_us":20000}})")
+	);
+
+	// tensors of shape [0,1] without data
+	auto header = json::parse(R"([
+		{"name":"x","type":"float32","shape":[0,1]},
+		{"name":"y","type":"float32","shape":[0,1]},
+		{"name":"z","type":"float32","shape":[0,1]}
+	])")
+					  .dump();
+	uint32_t header_length = header.size();
+	std::string payload(4 + header.size(), '\0');
+	std::memcpy(&payload[0], &header_length, 4);
+	std::memcpy(&payload[4], header.data(), header.size());
+	payload.resize((payload.size() + 7) / 8 * 8, '\0');
+
+	// both requests are queued within the same delay, so they would be merged into a batch of 0 rows
+	const int count = 2;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<std::unique_ptr<Orts::onnx::execution::context>> contexts;
+	std::vector<std::vector<int64_t>> shapes(count);
+	int completed = 0;
+	for (int i = 0; i < count; i++) {
+		contexts.emplace_back(std::make_unique<Orts::onnx::execution::context>(
+			batch_session, payload.data(), payload.size(), Orts::onnx::execution::PAYLOAD_TENSOR
+		));
+		contexts.back()->run(
+			Orts::onnx::deadline_t::max(),
+			[&, i](std::vector<Ort::Value> &outputs, std::exception_ptr error) {
+				std::lock_guard<std::mutex> lock(mutex);
+				if (error == nullptr && !outputs.empty())
+					shapes[i] = outputs.front().GetTensorTypeAndShapeInfo().GetShape();
+				completed++;
+				condition.notify_one();
+			}
+		);
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(10), [&]() { return completed == count; }));
+	for (auto &shape : shapes)
+		ASSERT_EQ(shape, std::vector<int64_t>({0, 1}));
+}
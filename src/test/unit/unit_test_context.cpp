@@ -1,6 +1,9 @@
 //
 // Created by Kibae Shin on 2023/09/02.
 //
+#include <cstring>
+#include <set>
+
 #include "../../onnxruntime_server.hpp"
 #include "../test_common.hpp"
 
@@ -67,3 +70,439 @@ TEST(test_onnxruntime_server_context, BertSquadModelTest) {
 	std::cout << json.dump(4) << "\n";
 	ASSERT_EQ(json["output"].size(), 3);
 }
+
+TEST(test_onnxruntime_server_context, SessionOptionTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(
+		key, model1_path.string(),
+		json::parse(R"({"intra_op_num_threads":1,"execution_mode":"parallel","graph_optimization_level":"basic",
+			"enable_cpu_mem_arena":false,"allow_spinning":false})")
+	);
+	auto option = session->to_json()["option"];
+	std::cout << option.dump(2) << "\n";
+	ASSERT_EQ(option["intra_op_num_threads"], 1);
+	ASSERT_EQ(option["execution_mode"], "parallel");
+	ASSERT_EQ(option["graph_optimization_level"], "basic");
+	ASSERT_FALSE(option["enable_cpu_mem_arena"]);
+	ASSERT_TRUE(option["enable_mem_pattern"]);
+	ASSERT_FALSE(option["allow_spinning"]);
+
+	Orts::onnx::execution::context ctx(session, R"({"x":[[1]],"y":[[2]],"z":[[3]]})");
+	auto result = ctx.run();
+	ASSERT_EQ(ctx.tensors_to_json(result)["output"].size(), 1);
+
+	ASSERT_THROW(
+		Orts::onnx::session(key, model1_path.string(), json::parse(R"({"graph_optimization_level":"fast"})")),
+		Orts::bad_request_error
+	);
+}
+
+TEST(test_onnxruntime_server_context, TensorPayloadTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+
+	// inputs in a different order than the model declares them
+	auto header = json::parse(R"([
+		{"name":"z","type":"float32","shape":[2,1]},
+		{"name":"x","type":"float32","shape":[2,1]},
+		{"name":"y","type":"float32","shape":[2,1]}
+	])")
+					  .dump();
+	std::vector<float> values = {3, 4, 1, 2, 2, 3};
+	uint32_t header_length = header.size();
+
+	std::string payload(4 + header.size(), '\0');
+	std::memcpy(&payload[0], &header_length, 4);
+	std::memcpy(&payload[4], header.data(), header.size());
+	payload.resize((payload.size() + 7) / 8 * 8, '\0');
+	for (size_t i = 0; i < values.size(); i += 2) {
+		payload.append(reinterpret_cast<const char *>(&values[i]), sizeof(float) * 2);
+		payload.resize((payload.size() + 7) / 8 * 8, '\0');
+	}
+
+	Orts::onnx::execution::context ctx(session, payload.data(), payload.size(), Orts::onnx::execution::PAYLOAD_TENSOR);
+	auto result = ctx.run();
+	auto output = ctx.tensors_to_tensor_payload(result);
+
+	Orts::onnx::execution::context json_ctx(session, R"({"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]})");
+	auto json_result = json_ctx.run();
+	auto expected = json_ctx.tensors_to_json(json_result);
+
+	uint32_t output_header_length;
+	std::memcpy(&output_header_length, output.data(), 4);
+	auto output_header = json::parse(output.substr(4, output_header_length));
+	std::cout << output_header.dump(2) << "\n";
+	ASSERT_EQ(output_header[0]["name"], "output");
+	ASSERT_EQ(output_header[0]["type"], "float32");
+	ASSERT_EQ(output_header[0]["shape"], json::parse("[2,1]"));
+
+	auto data_offset = (4 + output_header_length + 7) / 8 * 8;
+	ASSERT_EQ(output.size(), data_offset + 8);
+	float output_values[2];
+	std::memcpy(output_values, output.data() + data_offset, sizeof(output_values));
+	ASSERT_FLOAT_EQ(output_values[0], expected["output"][0][0].get<float>());
+	ASSERT_FLOAT_EQ(output_values[1], expected["output"][1][0].get<float>());
+
+	// truncated header
+	auto short_payload = payload.substr(0, 4 + header.size() - 1);
+	ASSERT_THROW(
+		Orts::onnx::execution::context(
+			session, short_payload.data(), short_payload.size(), Orts::onnx::execution::PAYLOAD_TENSOR
+		),
+		Orts::bad_request_error
+	);
+
+	// malformed headers and shapes are bad requests, not server errors
+	for (std::string bad_header : {
+			 R"([{"name":"x",)",
+			 R"([{"name":"x","type":"float32","shape":[-2,1]}])",
+			 R"([{"name":"x","type":"float32","shape":["2",1]}])",
+			 R"([{"name":"x","type":"float32","shape":[4611686018427387904,1]}])",
+		 }) {
+		uint32_t bad_header_length = bad_header.size();
+		std::string bad_payload(4, '\0');
+		std::memcpy(&bad_payload[0], &bad_header_length, 4);
+		bad_payload += bad_header;
+		bad_payload.resize((bad_payload.size() + 7) / 8 * 8 + 64, '\0');
+		ASSERT_THROW(
+			Orts::onnx::execution::context(
+				session, bad_payload.data(), bad_payload.size(), Orts::onnx::execution::PAYLOAD_TENSOR
+			),
+			Orts::bad_request_error
+		);
+	}
+}
+
+TEST(test_onnxruntime_server_context, SaxDecoderTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+
+	Orts::onnx::execution::context nested_ctx(session, R"({"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]})");
+	auto nested_result = nested_ctx.run();
+	auto expected = nested_ctx.tensors_to_json(nested_result);
+
+	// unknown keys are skipped and flat values are reshaped by the model shape
+	Orts::onnx::execution::context ctx(
+		session, R"({"meta":{"tags":[1,{"a":[2]}],"name":null},"x":[1,2],"y":[[2],[3]],"z":[[3],[4]]})"
+	);
+	auto result = ctx.run();
+	auto json = ctx.tensors_to_json(result);
+	std::cout << json.dump(4) << "\n";
+	ASSERT_EQ(json, expected);
+
+	// MessagePack goes through the same decoder
+	auto msgpack = json::to_msgpack(json::parse(R"({"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]})"));
+	Orts::onnx::execution::context msgpack_ctx(
+		session, reinterpret_cast<const char *>(msgpack.data()), msgpack.size(), Orts::onnx::execution::PAYLOAD_MSGPACK
+	);
+	auto msgpack_result = msgpack_ctx.run();
+	ASSERT_EQ(msgpack_ctx.tensors_to_json(msgpack_result), expected);
+
+	// a whole request keeps its scalar fields and reads the inputs under the root key. MessagePack announces the array
+	// lengths, so each input buffer is sized once
+	auto request = json::to_msgpack(json::parse(
+		R"({"model":"sample","extra":[1,{"a":2}],"data":{"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]},"timeout_ms":5})"
+	));
+	{
+		Orts::onnx::execution::arena decoder_arena;
+		Orts::onnx::execution::arena::use decode_into(&decoder_arena);
+		Orts::onnx::execution::arena::scope decoder_scope(decoder_arena);
+		Orts::onnx::execution::json_sax_decoder decoder(session->inputs(), "data");
+		decoder.parse(
+			reinterpret_cast<const char *>(request.data()), request.size(), Orts::onnx::execution::PAYLOAD_MSGPACK
+		);
+		ASSERT_TRUE(decoder.root_found);
+		ASSERT_EQ(decoder.fields, json::parse(R"({"model":"sample","timeout_ms":5})"));
+		ASSERT_EQ(decoder.tensors["x"].shape, std::vector<int64_t>({2, 1}));
+		ASSERT_EQ(decoder.tensors["x"].data.size(), 2 * sizeof(float));
+		ASSERT_EQ(decoder.tensors["x"].data.capacity(), 2 * sizeof(float));
+	}
+	Orts::onnx::execution::context request_ctx(
+		session, reinterpret_cast<const char *>(request.data()), request.size(), Orts::onnx::execution::PAYLOAD_MSGPACK,
+		"data"
+	);
+	auto request_result = request_ctx.run();
+	ASSERT_EQ(request_ctx.tensors_to_json(request_result), expected);
+	ASSERT_THROW(
+		Orts::onnx::execution::context(
+			session, R"({"data":[1]})", 12, Orts::onnx::execution::PAYLOAD_JSON, "data"
+		),
+		Orts::bad_request_error
+	);
+
+	ASSERT_THROW(Orts::onnx::execution::context(session, R"([1])"), Orts::bad_request_error);
+	ASSERT_THROW(Orts::onnx::execution::context(session, R"({"x":1,"y":[[2]],"z":[[3]]})"), Orts::bad_request_error);
+	ASSERT_THROW(
+		Orts::onnx::execution::context(session, R"({"x":[["a"]],"y":[[2]],"z":[[3]]})"), Orts::bad_request_error
+	);
+	ASSERT_THROW(Orts::onnx::execution::context(session, R"({"y":[[2]],"z":[[3]]})"), Orts::bad_request_error);
+	ASSERT_THROW(Orts::onnx::execution::context(session, R"({"x":[[1]],)"), Orts::bad_request_error);
+}
+
+TEST(test_onnxruntime_server_context, JsonTextWriterTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+
+	Orts::onnx::execution::context ctx(session, R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})");
+	auto result = ctx.run();
+	auto text = ctx.tensors_to_json_text(result);
+	std::cout << text << "\n";
+	ASSERT_EQ(text, ctx.tensors_to_json(result).dump());
+
+	auto rounded_session = std::make_shared<Orts::onnx::session>(
+		key, model1_path.string(), json::parse(R"({"float_precision":3})")
+	);
+	ASSERT_EQ(rounded_session->to_json()["option"]["float_precision"], 3);
+	Orts::onnx::execution::context rounded_ctx(
+		rounded_session, R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})"
+	);
+	auto rounded_result = rounded_ctx.run();
+	auto rounded = json::parse(rounded_ctx.tensors_to_json_text(rounded_result));
+	std::cout << rounded.dump() << "\n";
+	ASSERT_EQ(rounded["output"].size(), 3);
+	ASSERT_NEAR(rounded["output"][0][0].get<double>(), result[0].GetTensorData<float>()[0], 0.01);
+}
+
+TEST(test_onnxruntime_server_context, OptimizedModelCacheTest) {
+	auto cache_dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	Orts::onnx::session_key key("sample", "1");
+	auto bin = test_model_bin_getter("sample", "1");
+	auto input = R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})";
+
+	auto saved = std::make_shared<Orts::onnx::session>(key, bin, json::object(), nullptr, cache_dir.string());
+	ASSERT_EQ(saved->to_json()["option"]["optimized_model_cache"], "saved");
+	ASSERT_FALSE(boost::filesystem::is_empty(cache_dir));
+
+	auto cached = std::make_shared<Orts::onnx::session>(key, bin, json::object(), nullptr, cache_dir.string());
+	ASSERT_EQ(cached->to_json()["option"]["optimized_model_cache"], "hit");
+
+	// other session options must not reuse the graph optimized for the first ones
+	json option = json::object({{"graph_optimization_level", "basic"}});
+	auto other = std::make_shared<Orts::onnx::session>(key, bin, option, nullptr, cache_dir.string());
+	ASSERT_EQ(other->to_json()["option"]["optimized_model_cache"], "saved");
+
+	// options that only change how the graph runs share it
+	json runtime_option = json::object({{"timeout_ms", 1000}, {"priority", "high"}, {"replicas", 2}});
+	auto runtime = std::make_shared<Orts::onnx::session>(key, bin, runtime_option, nullptr, cache_dir.string());
+	ASSERT_EQ(runtime->to_json()["option"]["optimized_model_cache"], "hit");
+
+	Orts::onnx::execution::context saved_ctx(saved, input);
+	Orts::onnx::execution::context cached_ctx(cached, input);
+	auto saved_result = saved_ctx.run();
+	auto cached_result = cached_ctx.run();
+	ASSERT_EQ(saved_ctx.tensors_to_json(saved_result), cached_ctx.tensors_to_json(cached_result));
+
+	boost::filesystem::remove_all(cache_dir);
+}
+
+TEST(test_onnxruntime_server_context, ShareWeightsTest) {
+	// ORT does not report what the prepacked weights container holds. this only checks that sessions sharing one
+	// give the same results as each other
+	auto env = std::make_shared<Orts::onnx::environment>();
+	json option = json::object({{"share_weights", true}});
+	auto input = R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})";
+
+	auto replica1 = std::make_shared<Orts::onnx::session>(
+		Orts::onnx::session_key("sample", "1"), model1_path.string(), option, env
+	);
+	auto replica2 = std::make_shared<Orts::onnx::session>(
+		Orts::onnx::session_key("sample", "1-shared"), model1_path.string(), option, env
+	);
+	ASSERT_TRUE(replica1->to_json()["option"]["share_weights"]);
+
+	Orts::onnx::execution::context ctx1(replica1, input);
+	Orts::onnx::execution::context ctx2(replica2, input);
+	auto result1 = ctx1.run();
+	auto result2 = ctx2.run();
+	ASSERT_EQ(ctx1.tensors_to_json(result1), ctx2.tensors_to_json(result2));
+
+	json invalid_option = json::object({{"share_weights", 1}});
+	ASSERT_THROW(
+		Orts::onnx::session(Orts::onnx::session_key("sample", "1"), model1_path.string(), invalid_option),
+		Orts::bad_request_error
+	);
+}
+
+TEST(test_onnxruntime_server_context, ReplicaTest) {
+	Orts::onnx::session_key key("sample", "1");
+	json option = json::object({{"replicas", 3}, {"pin_replicas", true}});
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string(), option);
+	ASSERT_EQ(session->to_json()["option"]["replicas"], 3);
+	ASSERT_FALSE(session->to_json()["option"]["global_thread_pool"]);
+	ASSERT_EQ(session->to_json()["replicas"].size(), 3);
+
+	auto input = R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})";
+	Orts::onnx::execution::context expected_ctx(session, input);
+	auto expected_result = expected_ctx.run();
+	auto expected = expected_ctx.tensors_to_json(expected_result);
+	// an idle session runs on its first replica
+	ASSERT_EQ(session->to_json()["replicas"][0]["runs"], 1);
+
+	{
+		// runs in flight together hold different replicas
+		Orts::onnx::session::replica_run a(*session);
+		std::optional<Orts::onnx::session::replica_run> b(std::in_place, *session);
+		Orts::onnx::session::replica_run c(*session);
+		ASSERT_EQ(std::set<size_t>({a.index, b->index, c.index}).size(), 3);
+		ASSERT_EQ(session->to_json()["replicas"][b->index]["in_flight"], 1);
+
+		// the replica that finishes first takes the next run
+		auto released = b->index;
+		b.reset();
+		ASSERT_EQ(session->to_json()["replicas"][released]["in_flight"], 0);
+		b.emplace(*session);
+		ASSERT_EQ(b->index, released);
+	}
+
+	{
+		// while the first replica is busy, a run goes to the least busy one after it
+		Orts::onnx::session::replica_run busy(*session);
+		ASSERT_EQ(busy.index, 0);
+		auto runs = session->to_json()["replicas"][1]["runs"].get<uint64_t>();
+		Orts::onnx::execution::context ctx(session, input);
+		auto result = ctx.run();
+		ASSERT_EQ(ctx.tensors_to_json(result), expected);
+		ASSERT_EQ(session->to_json()["replicas"][1]["runs"], runs + 1);
+	}
+
+	uint64_t before = 0;
+	for (auto &replica : session->to_json()["replicas"])
+		before += replica["runs"].get<uint64_t>();
+
+	std::vector<std::thread> threads;
+	std::atomic<int> matched{0};
+	for (int i = 0; i < 8; i++) {
+		threads.emplace_back([&session, &input, &expected, &matched]() {
+			Orts::onnx::execution::context ctx(session, input);
+			auto result = ctx.run();
+			if (ctx.tensors_to_json(result) == expected)
+				matched++;
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	ASSERT_EQ(matched, 8);
+
+	uint64_t after = 0;
+	for (auto &replica : session->to_json()["replicas"]) {
+		after += replica["runs"].get<uint64_t>();
+		ASSERT_EQ(replica["in_flight"], 0);
+	}
+	ASSERT_EQ(after, before + 8);
+
+	json invalid_option = json::object({{"replicas", 0}});
+	ASSERT_THROW(Orts::onnx::session(key, model1_path.string(), invalid_option), Orts::bad_request_error);
+}
+
+TEST(test_onnxruntime_server_context, NumaNodeTest) {
+	// two pinned replicas split the four CPUs of a node; the calling thread is the first intra-op thread of each
+	std::vector<int> node_cpus({4, 5, 6, 7});
+	ASSERT_EQ(Orts::onnx::session::intra_op_affinities(node_cpus, true, 2, 0, 0), std::make_pair(2L, std::string("6")));
+	ASSERT_EQ(Orts::onnx::session::intra_op_affinities(node_cpus, true, 2, 1, 0), std::make_pair(2L, std::string("8")));
+	// unpinned, every intra-op thread may run on any CPU of the node
+	ASSERT_EQ(
+		Orts::onnx::session::intra_op_affinities(node_cpus, false, 1, 0, 0),
+		std::make_pair(4L, std::string("5,6,7,8;5,6,7,8;5,6,7,8"))
+	);
+	ASSERT_EQ(
+		Orts::onnx::session::intra_op_affinities(node_cpus, false, 1, 0, 2), std::make_pair(2L, std::string("5,6,7,8"))
+	);
+
+	// workers take the CPUs of the list in turn, and the node of their CPU
+	Orts::onnx::cpu_topology topology({{0, {0, 1}}, {1, {2, 3}}});
+	ASSERT_EQ(topology.worker_nodes({1, 2, 3}, 4), std::vector<int>({0, 1, 1, 0}));
+	ASSERT_EQ(topology.worker_nodes({3, 8}, 2), std::vector<int>({1, -1}));
+	ASSERT_TRUE(topology.worker_nodes({}, 4).empty());
+
+	Orts::onnx::session_key key("sample", "1");
+	auto node = Orts::onnx::cpu_topology::host().nodes().front();
+	json option = json::object({{"numa_node", node}});
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string(), option);
+	ASSERT_EQ(session->to_json()["option"]["numa_node"], node);
+	ASSERT_FALSE(session->to_json()["option"]["global_thread_pool"]);
+	ASSERT_EQ(session->placement().node, node);
+
+	Orts::onnx::execution::context ctx(session, R"({"x":[[1]],"y":[[2]],"z":[[3]]})");
+	auto result = ctx.run();
+	ASSERT_EQ(result.size(), 1);
+
+	json invalid_option = json::object({{"numa_node", 4096}});
+	ASSERT_THROW(Orts::onnx::session(key, model1_path.string(), invalid_option), Orts::bad_request_error);
+}
+
+TEST(test_onnxruntime_server_context, RequestPlacementTest) {
+	Orts::onnx::session_manager manager(test_model_bin_getter, 1);
+	manager.create_session("sample", "1", json::parse(R"({"priority":"low"})"));
+	auto request = json::parse(R"({"model":"sample","version":"1","data":{"x":[[1]],"y":[[2]],"z":[[3]]}})");
+
+	// requests follow the session unless they ask for a lane themselves
+	Orts::task::execute_session task(manager, request);
+	ASSERT_EQ(task.placement().priority, Orts::task_priority::low);
+	task.priority = Orts::task_priority::high;
+	ASSERT_EQ(task.placement().priority, Orts::task_priority::high);
+
+	request["version"] = "2";
+	Orts::task::execute_session unknown(manager, request);
+	ASSERT_EQ(unknown.placement().priority, Orts::task_priority::normal);
+	ASSERT_EQ(unknown.placement().node, -1);
+}
+
+TEST(test_onnxruntime_server_context, IoBindingTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto bound =
+		std::make_shared<Orts::onnx::session>(key, model1_path.string(), json::parse(R"({"io_binding":true})"));
+	auto unbound = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+	ASSERT_TRUE(bound->to_json()["option"]["io_binding"]);
+	ASSERT_FALSE(unbound->to_json()["option"]["io_binding"]);
+
+	// the second and third runs with the same shapes write into the outputs of the first one
+	std::string inputs[] = {
+		R"({"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]})",
+		R"({"x":[[5],[6]],"y":[[7],[8]],"z":[[9],[10]]})",
+		R"({"x":[[1],[2],[3]],"y":[[2],[3],[4]],"z":[[3],[4],[5]]})",
+		R"({"x":[[1],[2]],"y":[[2],[3]],"z":[[3],[4]]})",
+	};
+	for (auto &input : inputs) {
+		Orts::onnx::execution::context bound_ctx(bound, input);
+		auto bound_result = bound_ctx.run();
+		Orts::onnx::execution::context unbound_ctx(unbound, input);
+		auto unbound_result = unbound_ctx.run();
+		ASSERT_EQ(bound_ctx.tensors_to_json(bound_result), unbound_ctx.tensors_to_json(unbound_result));
+	}
+}
+
+TEST(test_onnxruntime_server_context, DeadlineTest) {
+	Orts::onnx::session_key key("sample", "1");
+	auto session = std::make_shared<Orts::onnx::session>(key, model1_path.string());
+	std::string input = R"({"x":[[1]],"y":[[2]],"z":[[3]]})";
+
+	// a run whose deadline already passed never starts
+	Orts::onnx::execution::context expired_ctx(session, input);
+	ASSERT_THROW(
+		expired_ctx.run(std::chrono::steady_clock::now() - std::chrono::milliseconds(1)), Orts::gateway_timeout_error
+	);
+
+	Orts::onnx::execution::context ctx(session, input);
+	auto result = ctx.run(std::chrono::steady_clock::now() + std::chrono::seconds(10));
+	ASSERT_GT(ctx.tensors_to_json(result)["output"][0], 0);
+
+	ASSERT_THROW(
+		Orts::onnx::session(key, model1_path.string(), json::parse(R"({"timeout_ms":-1})")), Orts::bad_request_error
+	);
+
+	// requests count their timeout from arrival, so one that waited in the queue past it is dropped
+	Orts::onnx::session_manager manager(test_model_bin_getter, 1);
+	auto timed = manager.create_session("sample", "1", json::parse(R"({"timeout_ms":50})"));
+	ASSERT_EQ(timed->timeout_ms(), 50);
+	ASSERT_EQ(timed->to_json()["option"]["timeout_ms"], 50);
+
+	Orts::task::execute_session stale(manager, "sample", "1", json::parse(input));
+	stale.received_at = std::chrono::steady_clock::now() - std::chrono::milliseconds(100);
+	ASSERT_THROW(stale.run(), Orts::gateway_timeout_error);
+
+	// the timeout of the request overrides the one of the session
+	Orts::task::execute_session patient(manager, "sample", "1", json::parse(input));
+	patient.received_at = stale.received_at;
+	patient.timeout_ms = 10000;
+	ASSERT_GT(patient.run()["output"][0], 0);
+}
@@ -0,0 +1,52 @@
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+TEST(unit_test_cpu_topology, CpuListTest) {
+	ASSERT_EQ(Orts::onnx::cpu_topology::parse_cpu_list("0-3,8"), std::vector<int>({0, 1, 2, 3, 8}));
+	ASSERT_EQ(Orts::onnx::cpu_topology::parse_cpu_list(" 8, 2-3 ,2\n"), std::vector<int>({2, 3, 8}));
+	ASSERT_TRUE(Orts::onnx::cpu_topology::parse_cpu_list("").empty());
+	ASSERT_THROW(Orts::onnx::cpu_topology::parse_cpu_list("3-1"), Orts::bad_request_error);
+	ASSERT_THROW(Orts::onnx::cpu_topology::parse_cpu_list("0-x"), Orts::bad_request_error);
+	ASSERT_THROW(Orts::onnx::cpu_topology::parse_cpu_list("1:2"), Orts::bad_request_error);
+
+	ASSERT_EQ(Orts::onnx::cpu_topology::to_cpu_list({0, 1, 2, 3, 8, 10, 11}), "0-3,8,10-11");
+	ASSERT_EQ(Orts::onnx::cpu_topology::to_cpu_list({}), "");
+}
+
+TEST(unit_test_cpu_topology, NodeTest) {
+	Orts::onnx::cpu_topology topology({{0, {0, 1, 2, 3}}, {1, {4, 5, 6, 7}}});
+	ASSERT_EQ(topology.nodes(), std::vector<int>({0, 1}));
+	ASSERT_EQ(topology.node_cpus(1), std::vector<int>({4, 5, 6, 7}));
+	ASSERT_TRUE(topology.node_cpus(2).empty());
+	ASSERT_EQ(topology.node_of(5), 1);
+	ASSERT_EQ(topology.node_of(8), -1);
+
+	// the host always has at least one node with a CPU
+	auto &host = Orts::onnx::cpu_topology::host();
+	ASSERT_FALSE(host.nodes().empty());
+	ASSERT_FALSE(host.node_cpus(host.nodes().front()).empty());
+}
+
+#ifdef __linux__
+TEST(unit_test_cpu_topology, PinScopeTest) {
+	cpu_set_t allowed;
+	ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+	int cpu = 0;
+	while (!CPU_ISSET(cpu, &allowed))
+		cpu++;
+
+	{
+		Orts::onnx::cpu_topology::pin_scope pinned({cpu});
+		ASSERT_EQ(sched_getcpu(), cpu);
+	}
+
+	// the CPUs the thread had before come back
+	cpu_set_t restored;
+	ASSERT_EQ(sched_getaffinity(0, sizeof(restored), &restored), 0);
+	ASSERT_TRUE(CPU_EQUAL(&allowed, &restored));
+}
+#endif
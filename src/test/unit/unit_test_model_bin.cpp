@@ -0,0 +1,39 @@
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+TEST(unit_test_model_bin, MapFile) {
+	std::ifstream file(model1_path.string(), std::ios::binary);
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	auto expected = buffer.str();
+
+	auto bin = Orts::onnx::model_bin::map_file(model1_path.string());
+	ASSERT_TRUE(bin.has_data());
+	ASSERT_EQ(bin.path, model1_path.string());
+	ASSERT_EQ(std::string(bin.data, bin.length), expected);
+
+	// the mapping stays valid as long as any copy holds it
+	auto copy = bin;
+	bin = Orts::onnx::model_bin();
+	ASSERT_FALSE(bin.has_data());
+	ASSERT_EQ(std::string(copy.data, copy.length), expected);
+
+	ASSERT_THROW(Orts::onnx::model_bin::map_file((model_root / "not-exists.onnx").string()), Orts::runtime_error);
+}
+
+TEST(unit_test_model_bin, Getter) {
+	auto bin = test_model_bin_getter("sample", "1");
+	ASSERT_TRUE(bin.has_data());
+
+	auto session = Orts::onnx::session(Orts::onnx::session_key("sample", "1"), bin.data, bin.length);
+	ASSERT_EQ(session.inputs().size(), 3);
+
+	ASSERT_THROW(test_model_bin_getter("sample", "not-exists"), std::runtime_error);
+
+	// getters returning the model as a string still convert
+	Orts::model_bin_getter_t string_getter = [](const std::string &, const std::string &) {
+		return std::string("model");
+	};
+	auto string_bin = string_getter("sample", "1");
+	ASSERT_EQ(std::string(string_bin.data, string_bin.length), "model");
+}
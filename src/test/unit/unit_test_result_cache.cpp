@@ -0,0 +1,81 @@
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+TEST(unit_test_result_cache, HashTest) {
+	// reference values of xxHash64
+	ASSERT_EQ(Orts::onnx::result_cache::hash("", 0), 0xEF46DB3751D8E999ULL);
+	ASSERT_EQ(Orts::onnx::result_cache::hash("abc", 3), 0x44BC2CF5AD770999ULL);
+	std::string long_text = "Nobody inspects the spammish repetition";
+	ASSERT_EQ(Orts::onnx::result_cache::hash(long_text.data(), long_text.size()), 0xFBCEA83C8A378BF1ULL);
+	std::string seeded(45, 'a');
+	ASSERT_EQ(Orts::onnx::result_cache::hash(seeded.data(), seeded.size(), 1), 0x74FEF5F65A97F82AULL);
+}
+
+TEST(unit_test_result_cache, EvictionTest) {
+	// room for two entries of 100 bytes with their bookkeeping
+	Orts::onnx::result_cache cache(500, 0);
+	cache.put(1, std::string(100, 'a'));
+	cache.put(2, std::string(100, 'b'));
+	ASSERT_EQ(cache.get(1), std::string(100, 'a'));
+
+	// 2 is the least recently used now
+	cache.put(3, std::string(100, 'c'));
+	ASSERT_FALSE(cache.get(2).has_value());
+	ASSERT_EQ(cache.get(1), std::string(100, 'a'));
+	ASSERT_EQ(cache.get(3), std::string(100, 'c'));
+
+	// values that do not fit at all are not cached
+	cache.put(4, std::string(1000, 'd'));
+	ASSERT_FALSE(cache.get(4).has_value());
+
+	auto stats = cache.to_json();
+	ASSERT_EQ(stats["hits"], 3);
+	ASSERT_EQ(stats["misses"], 2);
+	ASSERT_EQ(stats["evictions"], 1);
+	ASSERT_EQ(stats["entries"], 2);
+	ASSERT_LE(stats["bytes"].get<size_t>(), 500);
+}
+
+TEST(unit_test_result_cache, TtlTest) {
+	Orts::onnx::result_cache cache(1024, 20);
+	cache.put(1, "value");
+	ASSERT_EQ(cache.get(1), "value");
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	ASSERT_FALSE(cache.get(1).has_value());
+	ASSERT_EQ(cache.to_json()["entries"], 0);
+}
+
+TEST(unit_test_result_cache, SessionTest) {
+	Orts::onnx::session_manager manager(test_model_bin_getter, 1);
+	auto session = manager.create_session("sample", "1", json::parse(R"({"result_cache":{"ttl_ms":60000}})"));
+	ASSERT_EQ(session->to_json()["option"]["result_cache"]["ttl_ms"], 60000);
+
+	// outputs are cached per response format, whatever format the inputs came in
+	std::string input = R"({"x":[[1]],"y":[[2]],"z":[[3]]})";
+	Orts::task::execute_session first(manager, "sample", "1", json::parse(input));
+	auto result = first.run();
+	Orts::task::execute_session second(manager, "sample", "1", json::parse(input));
+	ASSERT_EQ(second.run(), result);
+
+	auto msgpack = json::to_msgpack(json::parse(input));
+	Orts::task::execute_session third(
+		manager, "sample", "1", (const char *)msgpack.data(), msgpack.size(), Orts::onnx::execution::PAYLOAD_MSGPACK
+	);
+	auto text = third.run(Orts::onnx::execution::PAYLOAD_JSON);
+	ASSERT_EQ(json::parse(text)["output"], result["output"]);
+	Orts::task::execute_session fourth(
+		manager, "sample", "1", input.data(), input.size(), Orts::onnx::execution::PAYLOAD_JSON
+	);
+	ASSERT_EQ(fourth.run(Orts::onnx::execution::PAYLOAD_JSON), text);
+
+	auto stats = session->to_json()["result_cache"];
+	ASSERT_EQ(stats["hits"], 2);
+	ASSERT_EQ(stats["misses"], 2);
+	ASSERT_EQ(stats["entries"], 2);
+
+	Orts::onnx::session_key key("sample", "1");
+	ASSERT_THROW(
+		Orts::onnx::session(key, model1_path.string(), json::parse(R"({"result_cache":{"max_bytes":0}})")),
+		Orts::bad_request_error
+	);
+}
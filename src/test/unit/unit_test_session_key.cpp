@@ -51,4 +51,49 @@ TEST(unit_test_session_key, Parse) {
 
 	auto parse_case4 = Orts::onnx::session_key_with_option::parse("model:version(cuda=true)");
 	ASSERT_TRUE(parse_case4[0].option["cuda"]);
+
+	auto parse_case5 = Orts::onnx::session_key_with_option::parse("model:version(max_batch_size=16, max_queue_delay_us=500)");
+	ASSERT_EQ(parse_case5[0].option["batching"]["max_batch_size"], 16);
+	ASSERT_EQ(parse_case5[0].option["batching"]["max_queue_delay_us"], 500);
+
+	auto parse_case6 = Orts::onnx::session_key_with_option::parse("model:version(batching=true)");
+	ASSERT_TRUE(parse_case6[0].option["batching"]);
+
+	auto parse_case7 = Orts::onnx::session_key_with_option::parse("model:version(intra=2, opt=basic, spin=false)");
+	ASSERT_EQ(parse_case7[0].option["intra_op_num_threads"], 2);
+	ASSERT_EQ(parse_case7[0].option["graph_optimization_level"], "basic");
+	ASSERT_FALSE(parse_case7[0].option["allow_spinning"]);
+
+	auto parse_case8 = Orts::onnx::session_key_with_option::parse("model:version(share=true)");
+	ASSERT_TRUE(parse_case8[0].option["share_weights"]);
+
+	auto parse_case9 = Orts::onnx::session_key_with_option::parse("model:version(replicas=4, pin=true)");
+	ASSERT_EQ(parse_case9[0].option["replicas"], 4);
+	ASSERT_TRUE(parse_case9[0].option["pin_replicas"]);
+
+	auto parse_case10 = Orts::onnx::session_key_with_option::parse("model:version(priority=high)");
+	ASSERT_EQ(parse_case10[0].option["priority"], "high");
+
+	auto parse_case11 =
+		Orts::onnx::session_key_with_option::parse("model:version(result_cache=true, cache_ttl_ms=500)");
+	ASSERT_EQ(parse_case11[0].option["result_cache"]["ttl_ms"], 500);
+	ASSERT_FALSE(parse_case11[0].option["result_cache"].contains("max_bytes"));
+}
+
+TEST(unit_test_session_key, Hash) {
+	Orts::onnx::session_key::hash hash;
+	auto key = Orts::onnx::session_key("model", "version");
+	ASSERT_TRUE(key == Orts::onnx::session_key::unchecked("model", "version"));
+	ASSERT_EQ(hash(key), hash(Orts::onnx::session_key::unchecked("model", "version")));
+	ASSERT_FALSE(key == Orts::onnx::session_key::unchecked("modelv", "ersion"));
+
+	ASSERT_THROW(Orts::onnx::session_key("model name", "version"), std::runtime_error);
+	ASSERT_NO_THROW(Orts::onnx::session_key::unchecked("model name", "version"));
+
+	std::unordered_map<Orts::onnx::session_key, int, Orts::onnx::session_key::hash> map;
+	map.emplace(key, 1);
+	map.emplace(Orts::onnx::session_key("model", "version2"), 2);
+	ASSERT_EQ(map.at(Orts::onnx::session_key::unchecked("model", "version")), 1);
+	ASSERT_EQ(map.at(Orts::onnx::session_key::unchecked("model", "version2")), 2);
+	ASSERT_EQ(map.count(Orts::onnx::session_key::unchecked("model name", "version")), 0);
 }
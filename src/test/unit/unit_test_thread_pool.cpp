@@ -0,0 +1,239 @@
+#include "../../onnxruntime_server.hpp"
+#include "../test_common.hpp"
+
+TEST(unit_test_thread_pool, MaxQueueDepthTest) {
+	Orts::builtin_thread_pool pool(1);
+	pool.set_limits(1, 0);
+
+	// keep the only worker busy so that the next task has to wait in the queue
+	std::promise<void> release;
+	auto released = release.get_future().share();
+	std::promise<void> started;
+	auto running = pool.enqueue([&started, released]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	auto queued = pool.enqueue([]() { return 1; });
+	ASSERT_EQ(pool.queue_depth(), 1);
+	ASSERT_THROW(pool.enqueue([]() { return 2; }), Orts::service_unavailable_error);
+	ASSERT_EQ(pool.rejected(), 1);
+
+	release.set_value();
+	running.get();
+	ASSERT_EQ(queued.get(), 1);
+	ASSERT_EQ(pool.queue_depth(), 0);
+
+	// room again once the queue drains
+	ASSERT_EQ(pool.enqueue([]() { return 3; }).get(), 3);
+}
+
+TEST(unit_test_thread_pool, MaxQueueWaitTest) {
+	Orts::builtin_thread_pool pool(1);
+
+	// teach the pool that a task takes about 20ms
+	for (int i = 0; i < 3; i++)
+		pool.enqueue([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }).get();
+	pool.set_limits(0, 30);
+
+	std::promise<void> release;
+	auto released = release.get_future().share();
+	std::promise<void> started;
+	auto running = pool.enqueue([&started, released]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	// two queued tasks are estimated at 40ms, over the limit
+	auto first = pool.enqueue([]() {});
+	auto second = pool.enqueue([]() {});
+	ASSERT_GE(pool.estimated_wait_ms(), 30);
+	ASSERT_THROW(pool.enqueue([]() {}), Orts::service_unavailable_error);
+	ASSERT_EQ(pool.rejected(), 1);
+
+	release.set_value();
+	running.get();
+	first.get();
+	second.get();
+}
+
+TEST(unit_test_thread_pool, PriorityTest) {
+	Orts::builtin_thread_pool pool(1);
+
+	std::promise<void> release;
+	auto released = release.get_future().share();
+	std::promise<void> started;
+	auto running = pool.enqueue([&started, released]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	// tasks queued behind the busy worker run by lane, then in arrival order
+	std::mutex mutex;
+	std::vector<std::string> order;
+	auto record = [&mutex, &order](const std::string &name) {
+		std::lock_guard<std::mutex> lock(mutex);
+		order.push_back(name);
+	};
+	auto low = pool.enqueue(Orts::task_priority::low, record, "low");
+	auto normal = pool.enqueue(record, "normal");
+	auto high1 = pool.enqueue(Orts::task_priority::high, record, "high1");
+	auto high2 = pool.enqueue(Orts::task_priority::high, record, "high2");
+	ASSERT_EQ(pool.queue_depth(Orts::task_priority::high), 2);
+	ASSERT_EQ(pool.queue_depth(), 4);
+
+	release.set_value();
+	running.get();
+	low.get();
+	ASSERT_EQ(order, std::vector<std::string>({"high1", "high2", "normal", "low"}));
+}
+
+TEST(unit_test_thread_pool, StarvationTest) {
+	Orts::builtin_thread_pool pool(1);
+	pool.set_starvation_limit(0);
+
+	std::promise<void> release;
+	auto released = release.get_future().share();
+	std::promise<void> started;
+	auto running = pool.enqueue([&started, released]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	// every queued task has starved past the limit, so the oldest goes first regardless of its lane
+	std::mutex mutex;
+	std::vector<std::string> order;
+	auto record = [&mutex, &order](const std::string &name) {
+		std::lock_guard<std::mutex> lock(mutex);
+		order.push_back(name);
+	};
+	auto low = pool.enqueue(Orts::task_priority::low, record, "low");
+	auto high = pool.enqueue(Orts::task_priority::high, record, "high");
+
+	release.set_value();
+	running.get();
+	high.get();
+	ASSERT_EQ(order, std::vector<std::string>({"low", "high"}));
+}
+
+TEST(unit_test_thread_pool, ParsePriorityTest) {
+	ASSERT_EQ(Orts::builtin_thread_pool::parse_priority("high"), Orts::task_priority::high);
+	ASSERT_EQ(Orts::builtin_thread_pool::parse_priority("low"), Orts::task_priority::low);
+	ASSERT_EQ(Orts::builtin_thread_pool::priority_name(Orts::task_priority::normal), "normal");
+	ASSERT_THROW(Orts::builtin_thread_pool::parse_priority("urgent"), Orts::bad_request_error);
+}
+
+TEST(unit_test_thread_pool, WorkStealingTest) {
+	Orts::builtin_thread_pool pool(2);
+
+	// a task enqueued by a worker goes to that worker's own queue. the other worker has to steal it, or the outer task
+	// would wait forever
+	auto outer = pool.enqueue([&pool]() {
+		auto inner = pool.enqueue([]() { return std::this_thread::get_id(); });
+		return inner.get() != std::this_thread::get_id();
+	});
+	ASSERT_TRUE(outer.get());
+
+	// posted tasks run without a future
+	std::promise<int> posted;
+	pool.post(Orts::task_priority::normal, [&posted]() { posted.set_value(7); });
+	ASSERT_EQ(posted.get_future().get(), 7);
+}
+
+TEST(unit_test_thread_pool, SmallTaskTest) {
+	int calls = 0;
+	Orts::small_task inline_task([&calls]() { calls++; });
+	inline_task();
+
+	// captures larger than the inline storage go to the heap
+	std::array<char, Orts::small_task::inline_size * 2> large{};
+	auto shared = std::make_shared<int>(0);
+	Orts::small_task heap_task([large, shared, &calls]() { calls += (int)large.size() > 0; });
+	ASSERT_EQ(shared.use_count(), 2);
+
+	Orts::small_task moved(std::move(heap_task));
+	ASSERT_FALSE(heap_task);
+	moved();
+	inline_task = std::move(moved);
+	inline_task();
+	ASSERT_EQ(calls, 3);
+
+	inline_task = Orts::small_task();
+	ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST(unit_test_thread_pool, NodePlacementTest) {
+	// worker 0 on node 0, worker 1 on node 1
+	std::mutex mutex;
+	std::map<std::size_t, std::thread::id> started;
+	Orts::builtin_thread_pool pool(2, {0, 1}, [&mutex, &started](std::size_t worker) {
+		std::lock_guard<std::mutex> lock(mutex);
+		started[worker] = std::this_thread::get_id();
+	});
+	auto here = []() { return std::this_thread::get_id(); };
+	Orts::task_placement node1(Orts::task_priority::normal, 1);
+	for (int i = 0; i < 5; i++) {
+		// once both workers are parked, a task placed on node 1 wakes the worker of node 1
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		std::lock_guard<std::mutex> lock(mutex);
+		ASSERT_EQ(pool.enqueue(node1, here).get(), started[1]);
+	}
+
+	// a busy node does not leave the other node's workers idle
+	std::promise<void> release;
+	auto released = release.get_future().share();
+	std::promise<std::thread::id> blocked;
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	auto blocking = pool.enqueue(node1, [&blocked, released]() {
+		blocked.set_value(std::this_thread::get_id());
+		released.wait();
+	});
+	std::lock_guard<std::mutex> lock(mutex);
+	ASSERT_EQ(blocked.get_future().get(), started[1]);
+	ASSERT_EQ(pool.enqueue(node1, here).get(), started[0]);
+	release.set_value();
+	blocking.get();
+
+	// the calling thread is not pinned to the node, so a task placed on it never runs in place of a worker
+	bool ran_here = false;
+	for (int i = 0; i < 100 && !ran_here; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		ran_here = pool.try_run_here(Orts::task_priority::normal, []() {});
+	}
+	ASSERT_TRUE(ran_here);
+	ASSERT_FALSE(pool.try_run_here(node1, []() { FAIL() << "ran on the calling thread"; }));
+}
+
+TEST(unit_test_thread_pool, RunHereTest) {
+	Orts::builtin_thread_pool pool(1);
+	auto caller = std::this_thread::get_id();
+
+	// the worker has to park before its turn can be taken
+	auto run_here = [&pool](const std::function<void()> &f) {
+		for (int i = 0; i < 100; i++) {
+			if (pool.try_run_here(Orts::task_priority::normal, f))
+				return true;
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		return false;
+	};
+
+	// the only worker stays parked while the caller runs in its place, and runs what was queued meanwhile
+	std::future<std::thread::id> queued;
+	ASSERT_TRUE(run_here([&pool, &queued, caller]() {
+		ASSERT_EQ(std::this_thread::get_id(), caller);
+		queued = pool.enqueue([]() { return std::this_thread::get_id(); });
+		ASSERT_EQ(queued.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+		ASSERT_FALSE(pool.try_run_here(Orts::task_priority::normal, []() {}));
+	}));
+	ASSERT_NE(queued.get(), caller);
+
+	// exceptions reach the caller and the worker comes back
+	ASSERT_THROW(run_here([]() { throw std::runtime_error("run here"); }), std::runtime_error);
+	ASSERT_EQ(pool.enqueue([]() { return 1; }).get(), 1);
+	ASSERT_TRUE(run_here([]() {}));
+}
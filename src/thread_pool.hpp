@@ -1,40 +1,172 @@
 #ifndef ONNX_RUNTIME_SERVER_THREAD_POOL_HPP
 #define ONNX_RUNTIME_SERVER_THREAD_POOL_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
 #include <iostream>
-#include <queue>
+#include <map>
+#include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "utils/exceptions.hpp"
 
 namespace onnxruntime_server {
-	class builtin_thread_pool {
+	enum class task_priority : int { low = 0, normal = 1, high = 2 };
+
+	// where a task should run. node is a NUMA node of the workers, -1 for any
+	struct task_placement {
+		task_priority priority = task_priority::normal;
+		int node = -1;
+
+		task_placement() = default;
+		task_placement(task_priority priority, int node = -1) : priority(priority), node(node) { // NOLINT
+		}
+	};
+
+	/**
+	 * Move-only callable for the worker queue. Callables up to inline_size bytes (lambdas capturing a few pointers,
+	 * a packaged_task) are stored in place, so queueing them does not allocate.
+	 */
+	class small_task {
 	  public:
-		explicit builtin_thread_pool(long threads) {
-			for (long i = 0; i < threads; ++i) {
-				workers.emplace_back([this] {
-					while (true) {
-						std::function<void()> task;
+		static constexpr std::size_t inline_size = 48;
 
-						{
-							std::unique_lock<std::mutex> lock(this->queue_mutex);
-							this->condition.wait(lock, [this] { return this->stop || !this->tasks.empty(); });
+		small_task() = default;
 
-							if (this->stop && this->tasks.empty()) {
-								return;
-							}
+		template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, small_task>>>
+		small_task(F &&f) { // NOLINT(google-explicit-constructor)
+			using T = std::decay_t<F>;
+			if constexpr (sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t) &&
+						  std::is_nothrow_move_constructible_v<T>) {
+				new (storage) T(std::forward<F>(f));
+				ops = inline_operations<T>();
+			} else {
+				*reinterpret_cast<T **>(storage) = new T(std::forward<F>(f));
+				ops = heap_operations<T>();
+			}
+		}
 
-							task = std::move(this->tasks.front());
-							this->tasks.pop();
-						}
+		small_task(small_task &&other) noexcept {
+			take(other);
+		}
 
-						task();
-					}
+		small_task &operator=(small_task &&other) noexcept {
+			if (this != &other) {
+				reset();
+				take(other);
+			}
+			return *this;
+		}
+
+		small_task(const small_task &) = delete;
+		small_task &operator=(const small_task &) = delete;
+
+		~small_task() {
+			reset();
+		}
+
+		void operator()() {
+			ops->invoke(storage);
+		}
+
+		explicit operator bool() const {
+			return ops != nullptr;
+		}
+
+	  private:
+		struct operations {
+			void (*invoke)(void *);
+			// move constructs into dst and destroys src
+			void (*relocate)(void *dst, void *src);
+			void (*destroy)(void *);
+		};
+
+		alignas(std::max_align_t) unsigned char storage[inline_size]{};
+		const operations *ops = nullptr;
+
+		template <class T> static const operations *inline_operations() {
+			static const operations instance{
+				[](void *p) { (*static_cast<T *>(p))(); },
+				[](void *dst, void *src) {
+					new (dst) T(std::move(*static_cast<T *>(src)));
+					static_cast<T *>(src)->~T();
+				},
+				[](void *p) { static_cast<T *>(p)->~T(); },
+			};
+			return &instance;
+		}
+
+		template <class T> static const operations *heap_operations() {
+			static const operations instance{
+				[](void *p) { (**static_cast<T **>(p))(); },
+				[](void *dst, void *src) { *static_cast<T **>(dst) = *static_cast<T **>(src); },
+				[](void *p) { delete *static_cast<T **>(p); },
+			};
+			return &instance;
+		}
+
+		void take(small_task &other) noexcept {
+			ops = other.ops;
+			if (ops != nullptr)
+				ops->relocate(storage, other.storage);
+			other.ops = nullptr;
+		}
+
+		void reset() {
+			if (ops != nullptr)
+				ops->destroy(storage);
+			ops = nullptr;
+		}
+	};
+
+	/**
+	 * Worker pool with one queue per worker. Tasks enqueued by a worker go to its own queue, and each other thread
+	 * (io threads, mostly) sticks to one queue. Idle workers steal from the other queues, highest priority first, and
+	 * park on their own condition variable so that an enqueue wakes at most one of them.
+	 *
+	 * With worker_nodes, worker i belongs to NUMA node worker_nodes[i]. Tasks placed on a node are queued on that
+	 * node's workers, and workers steal from their own node before the others. on_start runs first on each worker
+	 * thread, to pin it to the CPUs of its node.
+	 */
+	class builtin_thread_pool {
+	  public:
+		explicit builtin_thread_pool(
+			long threads, const std::vector<int> &worker_nodes = {},
+			const std::function<void(std::size_t)> &on_start = nullptr
+		)
+			: queues(std::max(threads, 1L)) {
+			place(worker_nodes);
+			for (long i = 0; i < threads; ++i) {
+				workers.emplace_back([this, i, on_start] {
+					if (on_start)
+						on_start((std::size_t)i);
+					work((std::size_t)i);
 				});
 			}
 		}
 
 		~builtin_thread_pool() {
 			stop = true;
-			condition.notify_all();
+			for (auto &queue : queues) {
+				{
+					std::unique_lock<std::mutex> lock(queue.mutex);
+					if (queue.parked) {
+						queue.parked = false;
+						parked_count--;
+					}
+				}
+				queue.condition.notify_all();
+			}
 
 			for (std::thread &worker : workers) {
 				worker.join();
@@ -43,37 +175,430 @@ namespace onnxruntime_server {
 
 		template <class F, class... Args>
 		auto enqueue(F &&f, Args &&...args) -> std::future<typename std::result_of<F(Args...)>::type> {
+			return enqueue(task_priority::normal, std::forward<F>(f), std::forward<Args>(args)...);
+		}
+
+		template <class F, class... Args>
+		auto enqueue(task_placement placement, F &&f, Args &&...args)
+			-> std::future<typename std::result_of<F(Args...)>::type> {
 			using return_type = typename std::result_of<F(Args...)>::type;
 
-			auto task = std::make_shared<std::packaged_task<return_type()>>(
-				std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-			);
+			std::packaged_task<return_type()> task(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+			std::future<return_type> result = task.get_future();
+			push(placement, small_task(std::move(task)));
+			return result;
+		}
 
-			std::future<return_type> result = task->get_future();
-			{
-				std::unique_lock<std::mutex> lock(queue_mutex);
+		// enqueue without a future, for callers that report their own results. exceptions thrown by the task are
+		// dropped, as they would be in a discarded future
+		template <class F> void post(task_placement placement, F &&f) {
+			push(placement, small_task(std::forward<F>(f)));
+		}
 
-				if (stop)
-					throw std::runtime_error("enqueue on stopped ThreadPool");
+		// runs f on the calling thread in place of a parked worker, which stays parked until f returns, so the pool
+		// still runs at most size() tasks at once. returns false without running f when no worker is parked or other
+		// tasks are waiting for one, and for tasks placed on a node, which only that node's pinned workers may run
+		template <class F> bool try_run_here(task_placement placement, F &&f) {
+			if (placement.node >= 0 || stop || queued_count.load() > 0 || parked_count.load() == 0)
+				return false;
+			auto index = lend();
+			if (index >= queues.size())
+				return false;
 
-				tasks.emplace([task]() { (*task)(); });
-			}
-			condition.notify_one();
-			return result;
+			struct lent_worker {
+				builtin_thread_pool &pool;
+				std::size_t index;
+				std::chrono::steady_clock::time_point started_at = std::chrono::steady_clock::now();
+				~lent_worker() {
+					pool.record_task_time(std::chrono::steady_clock::now() - started_at);
+					pool.give_back(index);
+				}
+			} guard{*this, index};
+			f();
+			return true;
+		}
+
+		// true when called from one of this pool's workers. waiting on a task enqueued from a worker can deadlock
+		[[nodiscard]] bool is_worker_thread() const {
+			return current_pool == this;
 		}
 
 		void flush() {
-			std::unique_lock<std::mutex> lock(queue_mutex);
-			tasks = std::queue<std::function<void()>>();
+			for (auto &queue : queues) {
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				for (std::size_t i = 0; i < queue.lanes.size(); i++) {
+					queued_count -= (long)queue.lanes[i].size();
+					ready_count -= (long)queue.lanes[i].size();
+					queue.sizes[i] = 0;
+					queue.lanes[i].clear();
+				}
+			}
+		}
+
+		// enqueue throws service_unavailable_error instead of queueing past these limits. 0 means unlimited
+		void set_limits(std::size_t max_queue_depth, long max_queue_wait_ms) {
+			this->max_queue_depth = max_queue_depth;
+			this->max_queue_wait_us = max_queue_wait_ms * 1000;
+		}
+
+		// a task that waited this long runs before newer tasks of higher priority
+		void set_starvation_limit(long ms) {
+			starvation_limit_us = ms * 1000;
+		}
+
+		[[nodiscard]] std::size_t queue_depth() const {
+			return (std::size_t)std::max(queued_count.load(), 0L);
+		}
+
+		[[nodiscard]] std::size_t queue_depth(task_priority priority) const {
+			std::size_t count = 0;
+			for (auto &queue : queues)
+				count += queue.sizes[(int)priority].load(std::memory_order_relaxed);
+			return count;
+		}
+
+		// time a task enqueued now would wait for a worker, from the average run time of recent tasks
+		[[nodiscard]] long estimated_wait_ms(task_priority priority = task_priority::normal) const {
+			return estimated_wait_us(priority) / 1000;
+		}
+
+		[[nodiscard]] long rejected() const {
+			return rejected_count.load();
+		}
+
+		[[nodiscard]] std::size_t size() const {
+			return workers.size();
+		}
+
+		static task_priority parse_priority(const std::string &name) {
+			if (name == "high")
+				return task_priority::high;
+			if (name == "normal")
+				return task_priority::normal;
+			if (name == "low")
+				return task_priority::low;
+			throw bad_request_error("Invalid priority: " + name + ". Must be one of high, normal and low");
+		}
+
+		static std::string priority_name(task_priority priority) {
+			switch (priority) {
+			case task_priority::high:
+				return "high";
+			case task_priority::low:
+				return "low";
+			default:
+				return "normal";
+			}
 		}
 
 	  protected:
+		struct queued_task {
+			small_task run;
+			std::chrono::steady_clock::time_point enqueued_at;
+		};
+
+		struct alignas(64) worker_queue {
+			std::mutex mutex;
+			std::condition_variable condition;
+			// one FIFO lane per task_priority
+			std::array<std::deque<queued_task>, 3> lanes;
+			// lane sizes and the arrival of each lane's front, readable without the mutex to find work to steal
+			std::array<std::atomic<std::size_t>, 3> sizes{};
+			std::array<std::atomic<std::chrono::steady_clock::rep>, 3> front_at{};
+			// the owning worker waits on condition. written with mutex held
+			std::atomic_bool parked = ATOMIC_VAR_INIT(false);
+			// the parked worker gave its turn to a try_run_here() caller and is not counted as parked
+			bool lent = false;
+			int node = -1;
+			// queues to look for work in, this one first, then those of the same node
+			std::vector<std::size_t> steal_order;
+		};
+
 		std::vector<std::thread> workers;
-		std::queue<std::function<void()>> tasks;
+		std::vector<worker_queue> queues;
+		// queues of the workers of each NUMA node
+		std::map<int, std::vector<std::size_t>> node_queues;
+		std::atomic<std::size_t> next_node_queue{0};
+
+		// tasks admitted but not yet taken by a worker, and those of them already in a queue
+		std::atomic<long> queued_count{0};
+		std::atomic<long> ready_count{0};
+		std::atomic<long> parked_count{0};
+		// workers awake and not running a task
+		std::atomic<long> searching_count{0};
+
+		std::atomic<std::size_t> max_queue_depth{0};
+		std::atomic<long> max_queue_wait_us{0};
+		std::atomic<long> starvation_limit_us{1000 * 1000};
+		std::atomic<long> average_task_us{0};
+		std::atomic<long> rejected_count{0};
+
+		void work(std::size_t index) {
+			current_pool = this;
+			current_worker = index;
+			auto &own = queues[index];
+			searching_count++;
+			while (true) {
+				small_task task;
+				if (take(index, task)) {
+					// the last searching worker hands the rest of the queue to a parked one before it gets busy
+					searching_count--;
+					if (ready_count.load() > 0)
+						wake(index);
+
+					auto started_at = std::chrono::steady_clock::now();
+					try {
+						task();
+					} catch (...) {
+						// posted tasks have nobody to report to. enqueued tasks keep their exception in the future
+					}
+					record_task_time(std::chrono::steady_clock::now() - started_at);
+					searching_count++;
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(own.mutex);
+				if (stop && queued_count.load() == 0) {
+					searching_count--;
+					return;
+				}
+
+				// park, unless a task was queued since take() looked. push() counts its task before it checks for
+				// searching and parked workers, so one of the two always sees the other
+				own.parked = true;
+				parked_count++;
+				searching_count--;
+				if (stop || ready_count.load() > 0) {
+					own.parked = false;
+					parked_count--;
+					searching_count++;
+					continue;
+				}
+				own.condition.wait(lock, [&own] { return !own.parked && !own.lent; });
+				searching_count++;
+			}
+		}
+
+		void place(const std::vector<int> &worker_nodes) {
+			for (std::size_t i = 0; i < queues.size(); i++) {
+				if (i < worker_nodes.size() && worker_nodes[i] >= 0) {
+					queues[i].node = worker_nodes[i];
+					node_queues[worker_nodes[i]].push_back(i);
+				}
+			}
+			for (std::size_t i = 0; i < queues.size(); i++) {
+				auto &order = queues[i].steal_order;
+				for (std::size_t k = 0; k < queues.size(); k++) {
+					if (queues[(i + k) % queues.size()].node == queues[i].node)
+						order.push_back((i + k) % queues.size());
+				}
+				for (std::size_t k = 0; k < queues.size(); k++) {
+					if (queues[(i + k) % queues.size()].node != queues[i].node)
+						order.push_back((i + k) % queues.size());
+				}
+			}
+		}
+
+		// the caller's own queue if it is a worker on the right node, otherwise one of the node's queues round-robin
+		std::size_t queue_for(int node) {
+			auto worker = is_worker_thread();
+			auto nodes = node < 0 ? node_queues.end() : node_queues.find(node);
+			if (nodes == node_queues.end())
+				return (worker ? current_worker : home_queue) % queues.size();
+			if (worker && queues[current_worker].node == node)
+				return current_worker;
+			return nodes->second[next_node_queue.fetch_add(1, std::memory_order_relaxed) % nodes->second.size()];
+		}
+
+		void push(task_placement placement, small_task &&run) {
+			if (stop)
+				throw std::runtime_error("enqueue on stopped ThreadPool");
+			auto priority = placement.priority;
+			admit(priority);
+
+			auto index = queue_for(placement.node);
+			auto &queue = queues[index];
+			try {
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				auto &lane = queue.lanes[(int)priority];
+				auto now = std::chrono::steady_clock::now();
+				lane.push_back({std::move(run), now});
+				if (lane.size() == 1)
+					queue.front_at[(int)priority].store(now.time_since_epoch().count(), std::memory_order_relaxed);
+				queue.sizes[(int)priority]++;
+				ready_count++;
+			} catch (...) {
+				queued_count--;
+				throw;
+			}
+
+			wake(index);
+		}
+
+		// wakes one parked worker, the owner of the queue first, then those of its node. a worker that is already
+		// searching for a task will find the new one, so nobody is woken then
+		void wake(std::size_t index) {
+			if (searching_count.load() > 0 || parked_count.load() == 0)
+				return;
+			for (auto i : queues[index].steal_order) {
+				auto &queue = queues[i];
+				if (!queue.parked.load(std::memory_order_relaxed))
+					continue;
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				if (queue.parked) {
+					queue.parked = false;
+					parked_count--;
+					lock.unlock();
+					queue.condition.notify_one();
+					return;
+				}
+			}
+		}
+
+		// takes a parked worker off the parked list. queues.size() when there is none
+		std::size_t lend() {
+			auto first = home_queue;
+			for (std::size_t k = 0; k < queues.size(); k++) {
+				auto i = (first + k) % queues.size();
+				auto &queue = queues[i];
+				if (!queue.parked.load(std::memory_order_relaxed))
+					continue;
+				std::unique_lock<std::mutex> lock(queue.mutex);
+				if (queue.parked) {
+					queue.parked = false;
+					queue.lent = true;
+					parked_count--;
+					return i;
+				}
+			}
+			return queues.size();
+		}
+
+		// parks the lent worker again, or lets it run the tasks queued in the meantime. same order as in work(), so a
+		// push() racing with this either sees the worker parked or is seen here
+		void give_back(std::size_t index) {
+			auto &queue = queues[index];
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			queue.lent = false;
+			queue.parked = true;
+			parked_count++;
+			if (stop || ready_count.load() > 0) {
+				queue.parked = false;
+				parked_count--;
+				lock.unlock();
+				queue.condition.notify_one();
+			}
+		}
+
+		// a starved task goes first wherever it is queued. otherwise the highest lane of any queue, in steal order
+		bool take(std::size_t index, small_task &task) {
+			auto now = std::chrono::steady_clock::now();
+			auto starved_at = (now - std::chrono::microseconds(starvation_limit_us.load())).time_since_epoch().count();
+			auto &order = queues[index].steal_order;
+			for (auto i : order) {
+				auto &queue = queues[i];
+				for (std::size_t lane = 0; lane < queue.lanes.size(); lane++) {
+					if (queue.sizes[lane].load(std::memory_order_relaxed) > 0 &&
+						queue.front_at[lane].load(std::memory_order_relaxed) <= starved_at &&
+						take_from(queue, now, task))
+						return true;
+				}
+			}
+
+			for (std::size_t lane = queues.front().lanes.size(); lane-- > 0;) {
+				for (auto i : order) {
+					auto &queue = queues[i];
+					if (queue.sizes[lane].load(std::memory_order_relaxed) > 0 && take_from(queue, now, task))
+						return true;
+				}
+			}
+			return false;
+		}
+
+		bool take_from(worker_queue &queue, std::chrono::steady_clock::time_point now, small_task &task) {
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			auto lane_index = next_lane(queue, now);
+			if (lane_index >= queue.lanes.size())
+				return false;
+
+			auto &lane = queue.lanes[lane_index];
+			task = std::move(lane.front().run);
+			lane.pop_front();
+			if (!lane.empty())
+				queue.front_at[lane_index].store(
+					lane.front().enqueued_at.time_since_epoch().count(), std::memory_order_relaxed
+				);
+			queue.sizes[lane_index]--;
+			queued_count--;
+			ready_count--;
+			return true;
+		}
+
+		// called with the queue's mutex held. the highest priority lane goes first, unless the oldest waiting task has
+		// starved past the limit. lanes.size() when the queue is empty
+		std::size_t next_lane(const worker_queue &queue, std::chrono::steady_clock::time_point now) const {
+			auto &lanes = queue.lanes;
+			std::size_t oldest = lanes.size();
+			for (std::size_t i = 0; i < lanes.size(); i++) {
+				if (!lanes[i].empty() &&
+					(oldest == lanes.size() || lanes[i].front().enqueued_at < lanes[oldest].front().enqueued_at))
+					oldest = i;
+			}
+			if (oldest == lanes.size() ||
+				now - lanes[oldest].front().enqueued_at >= std::chrono::microseconds(starvation_limit_us.load()))
+				return oldest;
+
+			for (std::size_t i = lanes.size(); i-- > 0;) {
+				if (!lanes[i].empty())
+					return i;
+			}
+			return oldest;
+		}
+
+		// only tasks of the same or higher priority run before a new one
+		long estimated_wait_us(task_priority priority) const {
+			if (workers.empty())
+				return 0;
+			std::size_t ahead = 0;
+			for (int i = (int)priority; i <= (int)task_priority::high; i++)
+				ahead += queue_depth((task_priority)i);
+			return (long)ahead * average_task_us.load() / (long)workers.size();
+		}
+
+		// counts the task as queued, or throws if that would go past the limits
+		void admit(task_priority priority) {
+			auto depth = (std::size_t)std::max(queued_count++, 0L);
+			if (max_queue_depth > 0 && depth >= max_queue_depth) {
+				queued_count--;
+				rejected_count++;
+				throw service_unavailable_error(
+					"Server is busy: " + std::to_string(depth) + " requests are already queued"
+				);
+			}
+			auto wait_us = estimated_wait_us(priority);
+			if (max_queue_wait_us > 0 && wait_us > max_queue_wait_us) {
+				queued_count--;
+				rejected_count++;
+				throw service_unavailable_error(
+					"Server is busy: estimated queue wait is " + std::to_string(wait_us / 1000) + "ms"
+				);
+			}
+		}
+
+		void record_task_time(std::chrono::steady_clock::duration elapsed) {
+			// moving average over roughly the last 8 tasks. racing updates only lose a sample
+			long us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+			auto average = average_task_us.load();
+			average_task_us.store(average == 0 ? us : average + (us - average) / 8);
+		}
 
-		std::mutex queue_mutex;
-		std::condition_variable condition;
 		std::atomic_bool stop = ATOMIC_VAR_INIT(false);
+
+		inline static thread_local const builtin_thread_pool *current_pool = nullptr;
+		inline static thread_local std::size_t current_worker = 0;
+		inline static std::atomic<std::size_t> next_home_queue{0};
+		// queue of the tasks enqueued by a thread that is not a worker, assigned round-robin per thread
+		inline static thread_local std::size_t home_queue = next_home_queue++;
 	};
 } // namespace onnxruntime_server
 
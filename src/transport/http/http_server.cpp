@@ -10,12 +10,6 @@ onnxruntime_server::transport::http::http_server::http_server(
 }
 
 void onnxruntime_server::transport::http::http_server::client_connected(asio::socket socket) {
-	http_session(std::move(socket), request_payload_limit()).run(get_onnx_session_manager(), swagger);
-
-	try {
-		socket.close();
-		PLOG(L_INFO) << "transport::http::http_server: worker killed" << std::endl;
-	} catch (std::exception &e) {
-		PLOG(L_WARNING) << "transport::http::http_server: socket close error " << e.what() << std::endl;
-	}
+	std::make_shared<http_session>(std::move(socket), get_onnx_session_manager(), swagger, request_payload_limit())
+		->run();
 }
@@ -34,27 +34,52 @@ namespace onnxruntime_server::transport::http {
 		get_response(const std::string &url, unsigned http_version);
 	};
 
-	class http_session_base {
+	/**
+	 * Asynchronous HTTP session. Socket I/O runs on the io_context threads, and requests that can take long
+	 * (execute, create and destroy session) are handled on the session_manager thread pool. The response is written
+	 * back on the io_context once the handler finishes, or once the batch of a batching session has run.
+	 */
+	class http_session_base : public std::enable_shared_from_this<http_session_base> {
 	  protected:
+		onnx::session_manager &session_manager;
+		swagger_serve &swagger;
 		std::size_t body_limit;
 		beast::flat_buffer buffer;
+		std::unique_ptr<beast::http::request_parser<beast::http::string_body>> req_parser;
+		std::shared_ptr<beast::http::response<beast::http::string_body>> res;
 
-		std::shared_ptr<beast::http::response<beast::http::string_body>> handle_request(
-			onnx::session_manager &session_manager, swagger_serve &swagger,
-			beast::http::request_parser<beast::http::string_body> &req_parser
-		);
+		// nullptr when the response is sent later through respond()
+		std::shared_ptr<beast::http::response<beast::http::string_body>>
+		handle_request(beast::http::request_parser<beast::http::string_body> &req_parser);
+		std::shared_ptr<beast::http::response<beast::http::string_body>>
+		error_response(const std::exception_ptr &error, unsigned version, bool keep_alive);
 
 		std::string _remote_endpoint;
 
+		void do_read();
+		void on_read(error_code ec);
+		void on_handled(std::shared_ptr<beast::http::response<beast::http::string_body>> res);
+		// hands the response to the io executor. callable from any thread
+		void respond(std::shared_ptr<beast::http::response<beast::http::string_body>> res);
+		void on_write(error_code ec);
+		// worker queue lane and NUMA node: the priority header, or the options of the session it executes
+		task_placement request_placement();
+
+		using completion_handler = std::function<void(error_code, std::size_t)>;
+		virtual void async_read(completion_handler &&handler) = 0;
+		virtual void async_write(completion_handler &&handler) = 0;
+		virtual void close() = 0;
+		virtual boost::asio::any_io_executor get_executor() = 0;
+
 	  private:
 		onnxruntime_server::task::benchmark request_time;
+		std::chrono::steady_clock::time_point received_at;
 
 	  public:
-		explicit http_session_base(std::size_t body_limit);
+		http_session_base(onnx::session_manager &session_manager, swagger_serve &swagger, std::size_t body_limit);
+		virtual ~http_session_base() = default;
 
-		void run(onnx::session_manager &session_manager, swagger_serve &swagger);
-		virtual error_code do_read(beast::http::request_parser<beast::http::string_body> &req_parser) = 0;
-		virtual error_code do_write(std::shared_ptr<beast::http::response<beast::http::string_body>> msg) = 0;
+		virtual void run() = 0;
 		virtual std::string get_remote_endpoint() = 0;
 	};
 
@@ -62,12 +87,18 @@ namespace onnxruntime_server::transport::http {
 	  private:
 		beast::tcp_stream stream;
 
-		error_code do_read(beast::http::request_parser<beast::http::string_body> &req_parser) override;
-		error_code do_write(std::shared_ptr<beast::http::response<beast::http::string_body>> msg) override;
-		std::string get_remote_endpoint() override;
+		void async_read(completion_handler &&handler) override;
+		void async_write(completion_handler &&handler) override;
+		void close() override;
+		boost::asio::any_io_executor get_executor() override;
 
 	  public:
-		http_session(asio::socket socket, size_t body_limit);
+		http_session(
+			asio::socket socket, onnx::session_manager &session_manager, swagger_serve &swagger, size_t body_limit
+		);
+
+		void run() override;
+		std::string get_remote_endpoint() override;
 	};
 
 	class http_server : public server {
@@ -87,12 +118,19 @@ namespace onnxruntime_server::transport::http {
 	  private:
 		boost::asio::ssl::stream<asio::socket> stream;
 
-		error_code do_read(beast::http::request_parser<beast::http::string_body> &req_parser) override;
-		error_code do_write(std::shared_ptr<beast::http::response<beast::http::string_body>> msg) override;
-		std::string get_remote_endpoint() override;
+		void async_read(completion_handler &&handler) override;
+		void async_write(completion_handler &&handler) override;
+		void close() override;
+		boost::asio::any_io_executor get_executor() override;
 
 	  public:
-		https_session(asio::socket socket, boost::asio::ssl::context &ctx, size_t body_limit);
+		https_session(
+			asio::socket socket, boost::asio::ssl::context &ctx, onnx::session_manager &session_manager,
+			swagger_serve &swagger, size_t body_limit
+		);
+
+		void run() override;
+		std::string get_remote_endpoint() override;
 	};
 
 	class https_server : public server {
@@ -1,34 +1,41 @@
 #include "http_server.hpp"
 
-onnxruntime_server::transport::http::http_session::http_session(asio::socket socket, size_t body_limit)
-	: http_session_base(body_limit), stream(std::move(socket)) {
+onnxruntime_server::transport::http::http_session::http_session(
+	asio::socket socket, onnx::session_manager &session_manager, swagger_serve &swagger, size_t body_limit
+)
+	: http_session_base(session_manager, swagger, body_limit), stream(std::move(socket)) {
 	stream.expires_never();
 }
 
-error_code onnxruntime_server::transport::http::http_session::do_read(
-	beast::http::request_parser<beast::http::string_body> &req_parser
-) {
-	boost::system::error_code ec;
+void onnxruntime_server::transport::http::http_session::run() {
+	do_read();
+}
 
-	buffer.clear();
-	req_parser.body_limit(body_limit);
+void onnxruntime_server::transport::http::http_session::async_read(completion_handler &&handler) {
+	beast::http::async_read(stream, buffer, *req_parser, std::move(handler));
+}
 
-	beast::http::read(stream, buffer, req_parser, ec);
-	return ec;
+void onnxruntime_server::transport::http::http_session::async_write(completion_handler &&handler) {
+	beast::http::async_write(stream, *res, std::move(handler));
 }
 
-boost::system::error_code onnxruntime_server::transport::http::http_session::do_write(
-	std::shared_ptr<beast::http::response<beast::http::string_body>> msg
-) {
+void onnxruntime_server::transport::http::http_session::close() {
 	boost::system::error_code ec;
-	beast::http::write(stream, *msg, ec);
-	return ec;
+	stream.socket().shutdown(asio::socket::shutdown_send, ec);
+	stream.socket().close(ec);
+	PLOG(L_INFO) << "transport::http::http_session: closed" << std::endl;
+}
+
+boost::asio::any_io_executor onnxruntime_server::transport::http::http_session::get_executor() {
+	return stream.get_executor();
 }
 
 std::string onnxruntime_server::transport::http::http_session::get_remote_endpoint() {
-	if (_remote_endpoint.empty())
-		_remote_endpoint = stream.socket().remote_endpoint().address().to_string() + ":" +
-						   std::to_string(stream.socket().remote_endpoint().port());
+	if (_remote_endpoint.empty()) {
+		boost::system::error_code ec;
+		auto endpoint = stream.socket().remote_endpoint(ec);
+		_remote_endpoint = endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+	}
 
 	return _remote_endpoint;
 }
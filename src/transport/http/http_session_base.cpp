@@ -1,91 +1,232 @@
 #include "http_server.hpp"
 
-onnxruntime_server::transport::http::http_session_base::http_session_base(std::size_t body_limit)
-	: buffer(), body_limit(body_limit) {
+onnxruntime_server::transport::http::http_session_base::http_session_base(
+	onnx::session_manager &session_manager, swagger_serve &swagger, std::size_t body_limit
+)
+	: session_manager(session_manager), swagger(swagger), body_limit(body_limit), buffer() {
 }
 
 #define CONTENT_TYPE_PLAIN_TEXT "text/plain"
 #define CONTENT_TYPE_JSON "application/json"
+#define CONTENT_TYPE_TENSOR "application/vnd.onnxruntime-server.tensor"
+#define CONTENT_TYPE_MSGPACK "application/msgpack"
+#define CONTENT_TYPE_CBOR "application/cbor"
+#define HEADER_REQUEST_TIMEOUT "X-Request-Timeout-Ms"
+#define HEADER_REQUEST_PRIORITY "X-Request-Priority"
 
-void onnxruntime_server::transport::http::http_session_base::run(
-	onnxruntime_server::onnx::session_manager &session_manager,
-	onnxruntime_server::transport::http::swagger_serve &swagger
+// compiled once: request_placement runs it on the io thread for every request before handle_request does
+static const std::regex session_path_re(R"(/api/sessions/([^/]+)/([^/]+))");
+
+static Orts::onnx::execution::payload_format content_type_to_format(beast::string_view content_type) {
+	if (content_type.find(CONTENT_TYPE_TENSOR) != beast::string_view::npos)
+		return Orts::onnx::execution::PAYLOAD_TENSOR;
+	if (content_type.find(CONTENT_TYPE_MSGPACK) != beast::string_view::npos)
+		return Orts::onnx::execution::PAYLOAD_MSGPACK;
+	if (content_type.find(CONTENT_TYPE_CBOR) != beast::string_view::npos)
+		return Orts::onnx::execution::PAYLOAD_CBOR;
+	return Orts::onnx::execution::PAYLOAD_JSON;
+}
+
+static std::shared_ptr<beast::http::response<beast::http::string_body>> make_response(
+	beast::http::status status, beast::string_view content_type, std::string body, unsigned version, bool keep_alive
 ) {
-	while (true) {
-		beast::http::request_parser<beast::http::string_body> req_parser;
-		boost::system::error_code ec = do_read(req_parser);
-		if (ec == beast::http::error::end_of_stream)
-			break;
-		else if (ec) {
-			PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::do_read: " << ec.message() << std::endl;
-			break;
-		}
+	auto res = std::make_shared<beast::http::response<beast::http::string_body>>(status, version);
+	res->set(beast::http::field::content_type, content_type);
+	res->keep_alive(keep_alive);
+	res->body() = std::move(body);
+	res->prepare_payload();
+	return res;
+}
 
-		auto req = req_parser.get();
-		request_time.touch();
-		auto res = handle_request(session_manager, swagger, req_parser);
-		PLOG(L_INFO, "ACCESS") << get_remote_endpoint() << " task: " << req.method_string() << " " << req.target()
-							   << " status: " << res->result_int() << " duration: " << request_time.get_duration()
-							   << std::endl;
-
-		ec = do_write(res);
-		if (ec) {
-			PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::do_write: " << ec.message() << std::endl;
-			break;
-		}
+static const char *format_to_content_type(Orts::onnx::execution::payload_format format) {
+	switch (format) {
+	case Orts::onnx::execution::PAYLOAD_TENSOR:
+		return CONTENT_TYPE_TENSOR;
+	case Orts::onnx::execution::PAYLOAD_MSGPACK:
+		return CONTENT_TYPE_MSGPACK;
+	case Orts::onnx::execution::PAYLOAD_CBOR:
+		return CONTENT_TYPE_CBOR;
+	default:
+		return CONTENT_TYPE_JSON;
+	}
+}
+
+void onnxruntime_server::transport::http::http_session_base::do_read() {
+	req_parser = std::make_unique<beast::http::request_parser<beast::http::string_body>>();
+	req_parser->body_limit(body_limit);
+
+	async_read([self = shared_from_this()](error_code ec, std::size_t) { self->on_read(ec); });
+}
+
+void onnxruntime_server::transport::http::http_session_base::on_read(error_code ec) {
+	if (ec == beast::http::error::end_of_stream)
+		return close();
+	if (ec) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::do_read: " << ec.message() << std::endl;
+		return close();
+	}
+
+	request_time.touch();
+	received_at = std::chrono::steady_clock::now();
 
-		if (!req.keep_alive())
-			break;
+	// GET requests only read the session list or static content, so they are answered on the io thread. creating a
+	// session hands the load to the loader pool and answers once it is done. everything else may run a model and is
+	// handed to the worker pool.
+	auto &req = req_parser->get();
+	if (req.method() == beast::http::verb::get ||
+		(req.method() == beast::http::verb::post && req.target() == "/api/sessions")) {
+		auto res = handle_request(*req_parser);
+		if (res != nullptr)
+			on_handled(res);
+		return;
+	}
+
+	try {
+		session_manager.thread_pool.post(request_placement(), [self = shared_from_this()]() {
+			auto res = self->handle_request(*self->req_parser);
+			if (res != nullptr)
+				self->respond(res);
+		});
+	} catch (Orts::exception &e) {
+		// rejected by admission control or an invalid priority header. answer right away so the client can back off or
+		// retry elsewhere
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::on_read: " << e.what() << std::endl;
+
+		auto res = std::make_shared<beast::http::response<beast::http::string_body>>(e.status_code, req.version());
+		res->set(beast::http::field::content_type, CONTENT_TYPE_JSON);
+		res->keep_alive(req.keep_alive());
+		res->body() = Orts::exception::what_to_json(e.type(), e.what());
+		res->prepare_payload();
+		on_handled(res);
+	} catch (std::exception &e) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::on_read: " << e.what() << std::endl;
+		close();
 	}
 }
 
+Orts::task_placement onnxruntime_server::transport::http::http_session_base::request_placement() {
+	auto &req = req_parser->get();
+	task_placement placement;
+
+	std::smatch match;
+	auto target = std::string(req.target());
+	if (req.method() == beast::http::verb::post && std::regex_match(target, match, session_path_re)) {
+		auto session = session_manager.get_session(match[1].str(), match[2].str());
+		if (session != nullptr)
+			placement = session->placement();
+	}
+
+	auto header = req.find(HEADER_REQUEST_PRIORITY);
+	if (header != req.end())
+		placement.priority = builtin_thread_pool::parse_priority(std::string(header->value()));
+	return placement;
+}
+
+void onnxruntime_server::transport::http::http_session_base::on_handled(
+	std::shared_ptr<beast::http::response<beast::http::string_body>> res
+) {
+	auto &req = req_parser->get();
+	PLOG(L_INFO, "ACCESS") << get_remote_endpoint() << " task: " << req.method_string() << " " << req.target()
+						   << " status: " << res->result_int() << " duration: " << request_time.get_duration()
+						   << std::endl;
+
+	this->res = std::move(res);
+	async_write([self = shared_from_this()](error_code ec, std::size_t) { self->on_write(ec); });
+}
+
+void onnxruntime_server::transport::http::http_session_base::respond(
+	std::shared_ptr<beast::http::response<beast::http::string_body>> res
+) {
+	boost::asio::post(get_executor(), [self = shared_from_this(), res]() { self->on_handled(res); });
+}
+
+void onnxruntime_server::transport::http::http_session_base::on_write(error_code ec) {
+	if (ec) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::do_write: " << ec.message() << std::endl;
+		return close();
+	}
+
+	auto keep_alive = res->keep_alive();
+	res = nullptr;
+	if (!keep_alive)
+		return close();
+
+	do_read();
+}
+
 std::shared_ptr<beast::http::response<beast::http::string_body>>
 onnxruntime_server::transport::http::http_session_base::handle_request(
-	onnx::session_manager &session_manager, swagger_serve &swagger,
 	beast::http::request_parser<beast::http::string_body> &req_parser
 ) {
-	auto req = req_parser.get();
+	auto &req = req_parser.get();
 
-	auto const simple_response =
-		[req](beast::http::status method, beast::string_view content_type, beast::string_view body) {
-			auto res = std::make_shared<beast::http::response<beast::http::string_body>>(method, req.version());
-			res->set(beast::http::field::content_type, content_type);
-			res->keep_alive(req.keep_alive());
-			res->body() = std::string(body);
-			res->prepare_payload();
-			return res;
-		};
+	auto const simple_response = [&req](beast::http::status status, beast::string_view content_type, std::string body) {
+		return make_response(status, content_type, std::move(body), req.version(), req.keep_alive());
+	};
+
+	// request and response encodings are negotiated by Content-Type and Accept. errors are always JSON
+	auto format = content_type_to_format(req[beast::http::field::content_type]);
+	auto accept = content_type_to_format(req[beast::http::field::accept]);
+	// only execute session can answer with a tensor payload
+	auto json_accept = accept == onnx::execution::PAYLOAD_TENSOR ? onnx::execution::PAYLOAD_JSON : accept;
+	auto const json_response = [&simple_response, json_accept](const json &res) {
+		return simple_response(
+			beast::http::status::ok, format_to_content_type(json_accept),
+			onnx::execution::encode_payload(res, json_accept)
+		);
+	};
 
 	try {
 		auto target = std::string(req.target());
 
-		std::regex re(R"(/api/sessions/([^/]+)/([^/]+))");
 		std::smatch match;
 		if ((req.method() == boost::beast::http::verb::get || req.method() == boost::beast::http::verb::post ||
 			 req.method() == boost::beast::http::verb::delete_) &&
-			std::regex_match(target, match, re) && match.size() > 1) {
+			std::regex_match(target, match, session_path_re) && match.size() > 1) {
 			auto model = match[1].str();
 			auto version = match[2].str();
 
 			// API: Execute sessions
 			if (req.method() == boost::beast::http::verb::post) {
-				auto task = task::execute_session(session_manager, model, version, json::parse(req.body()));
-				auto res = task.run();
-				return simple_response(beast::http::status::ok, CONTENT_TYPE_JSON, res.dump());
+				// the request body is decoded in place. tensor payloads are wrapped without per-element conversion
+				auto task = task::execute_session(
+					session_manager, model, version, req.body().data(), req.body().size(), format
+				);
+				task.received_at = received_at;
+				auto timeout = req.find(HEADER_REQUEST_TIMEOUT);
+				if (timeout != req.end()) {
+					try {
+						task.timeout_ms = std::stol(std::string(timeout->value()));
+					} catch (std::exception &) {
+						task.timeout_ms = -1;
+					}
+					if (task.timeout_ms < 0)
+						throw bad_request_error(HEADER_REQUEST_TIMEOUT " must be a non-negative integer");
+				}
+				// a batching session answers from its scheduler thread, so the worker is free while the batch fills up
+				task.run(
+					accept, [self = shared_from_this(), version = req.version(), keep_alive = req.keep_alive(),
+							 accept](std::string res, std::exception_ptr error) {
+						if (error != nullptr)
+							return self->respond(self->error_response(error, version, keep_alive));
+						self->respond(make_response(
+							beast::http::status::ok, format_to_content_type(accept), std::move(res), version, keep_alive
+						));
+					}
+				);
+				return nullptr;
 			}
 
 			// API: Get sessions
 			if (req.method() == boost::beast::http::verb::get) {
 				auto task = task::get_session(session_manager, model, version);
-				auto res = task.run();
-				return simple_response(beast::http::status::ok, CONTENT_TYPE_JSON, res.dump());
+				return json_response(task.run());
 			}
 
 			// API: Destroy sessions
 			if (req.method() == boost::beast::http::verb::delete_) {
 				auto task = task::destroy_session(session_manager, model, version);
-				auto res = task.run();
-				return simple_response(beast::http::status::ok, CONTENT_TYPE_JSON, res.dump());
+				return json_response(task.run());
 			}
 		}
 
@@ -93,20 +234,48 @@ onnxruntime_server::transport::http::http_session_base::handle_request(
 			// API: List sessions
 			if (req.method() == boost::beast::http::verb::get) {
 				auto task = task::list_session(session_manager);
-				auto res = task.run();
-				return simple_response(beast::http::status::ok, CONTENT_TYPE_JSON, res.dump());
+				return json_response(task.run());
 			}
 
 			// API: Create session
 			if (req.method() == boost::beast::http::verb::post) {
-				auto task = task::create_session(session_manager, json::parse(req.body()));
-				auto res = task.run();
-				return simple_response(beast::http::status::ok, CONTENT_TYPE_JSON, res.dump());
+				auto task = task::create_session(
+					session_manager, onnx::execution::decode_payload(req.body().data(), req.body().size(), format)
+				);
+				if (task.async)
+					return simple_response(
+						beast::http::status::accepted, format_to_content_type(json_accept),
+						onnx::execution::encode_payload(task.run(), json_accept)
+					);
+
+				// the load runs on the loader pool, and the response is sent from there once it is done
+				task.run([self = shared_from_this(), version = req.version(), keep_alive = req.keep_alive(),
+						  json_accept](json res, std::exception_ptr error) {
+					if (error == nullptr) {
+						try {
+							return self->respond(make_response(
+								beast::http::status::ok, format_to_content_type(json_accept),
+								onnx::execution::encode_payload(res, json_accept), version, keep_alive
+							));
+						} catch (...) {
+							error = std::current_exception();
+						}
+					}
+					self->respond(self->error_response(error, version, keep_alive));
+				});
+				return nullptr;
 			}
 		}
 
-		if (target == "/health")
+		// API: Worker queue statistics
+		if (target == "/api/stats" && req.method() == boost::beast::http::verb::get)
+			return json_response(session_manager.stats());
+
+		if (target == "/health") {
+			if (!session_manager.is_ready())
+				return simple_response(beast::http::status::service_unavailable, CONTENT_TYPE_PLAIN_TEXT, "Not Ready");
 			return simple_response(beast::http::status::ok, CONTENT_TYPE_PLAIN_TEXT, "OK");
+		}
 
 		if (swagger.is_swagger_url(target)) {
 			auto res = swagger.get_response(target, req.version());
@@ -115,16 +284,29 @@ onnxruntime_server::transport::http::http_session_base::handle_request(
 		}
 
 		return simple_response(beast::http::status::not_found, CONTENT_TYPE_PLAIN_TEXT, "Not Found");
+	} catch (...) {
+		return error_response(std::current_exception(), req.version(), req.keep_alive());
+	}
+}
+
+std::shared_ptr<beast::http::response<beast::http::string_body>>
+onnxruntime_server::transport::http::http_session_base::error_response(
+	const std::exception_ptr &error, unsigned version, bool keep_alive
+) {
+	try {
+		std::rethrow_exception(error);
 	} catch (Orts::exception &e) {
 		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::handle_request: " << e.what() << std::endl;
 
-		return simple_response(e.status_code, CONTENT_TYPE_JSON, Orts::exception::what_to_json(e.type(), e.what()));
+		return make_response(
+			e.status_code, CONTENT_TYPE_JSON, Orts::exception::what_to_json(e.type(), e.what()), version, keep_alive
+		);
 	} catch (std::exception &e) {
 		PLOG(L_WARNING) << get_remote_endpoint() << " transport::http::handle_request: " << e.what() << std::endl;
 
-		return simple_response(
+		return make_response(
 			beast::http::status::internal_server_error, CONTENT_TYPE_JSON,
-			Orts::exception::what_to_json("runtime_error", e.what())
+			Orts::exception::what_to_json("runtime_error", e.what()), version, keep_alive
 		);
 	}
 }
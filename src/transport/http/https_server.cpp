@@ -30,12 +30,6 @@ Orts::transport::http::https_server::https_server(
 }
 
 void onnxruntime_server::transport::http::https_server::client_connected(asio::socket socket) {
-	https_session(std::move(socket), ctx, request_payload_limit()).run(get_onnx_session_manager(), swagger);
-
-	try {
-		socket.close();
-		PLOG(L_INFO) << "transport::https::https_server: worker killed" << std::endl;
-	} catch (std::exception &e) {
-		PLOG(L_WARNING) << "transport::http::https_server: socket close error " << e.what() << std::endl;
-	}
+	std::make_shared<https_session>(std::move(socket), ctx, get_onnx_session_manager(), swagger, request_payload_limit())
+		->run();
 }
@@ -1,36 +1,52 @@
 #include "http_server.hpp"
 
 onnxruntime_server::transport::http::https_session::https_session(
-	asio::socket socket, boost::asio::ssl::context &ctx, size_t body_limit
+	asio::socket socket, boost::asio::ssl::context &ctx, onnx::session_manager &session_manager,
+	swagger_serve &swagger, size_t body_limit
 )
-	: http_session_base(body_limit), stream(std::move(socket), ctx) {
-	stream.handshake(boost::asio::ssl::stream_base::server);
+	: http_session_base(session_manager, swagger, body_limit), stream(std::move(socket), ctx) {
 }
 
-error_code onnxruntime_server::transport::http::https_session::do_read(
-	beast::http::request_parser<beast::http::string_body> &req_parser
-) {
-	boost::system::error_code ec;
+void onnxruntime_server::transport::http::https_session::run() {
+	stream.async_handshake(
+		boost::asio::ssl::stream_base::server,
+		[self = std::static_pointer_cast<https_session>(shared_from_this())](error_code ec) {
+			if (ec) {
+				PLOG(L_WARNING) << self->get_remote_endpoint() << " transport::https::handshake: " << ec.message()
+								<< std::endl;
+				return self->close();
+			}
+			self->do_read();
+		}
+	);
+}
+
+void onnxruntime_server::transport::http::https_session::async_read(completion_handler &&handler) {
+	beast::http::async_read(stream, buffer, *req_parser, std::move(handler));
+}
 
-	buffer.clear();
-	req_parser.body_limit(body_limit);
+void onnxruntime_server::transport::http::https_session::async_write(completion_handler &&handler) {
+	beast::http::async_write(stream, *res, std::move(handler));
+}
 
-	beast::http::read(stream, buffer, req_parser, ec);
-	return ec;
+void onnxruntime_server::transport::http::https_session::close() {
+	stream.async_shutdown([self = shared_from_this(), this](error_code) {
+		boost::system::error_code ec;
+		stream.lowest_layer().close(ec);
+		PLOG(L_INFO) << "transport::https::https_session: closed" << std::endl;
+	});
 }
 
-boost::system::error_code onnxruntime_server::transport::http::https_session::do_write(
-	std::shared_ptr<beast::http::response<beast::http::string_body>> msg
-) {
-	boost::system::error_code ec;
-	beast::http::write(stream, *msg, ec);
-	return ec;
+boost::asio::any_io_executor onnxruntime_server::transport::http::https_session::get_executor() {
+	return stream.get_executor();
 }
 
 std::string onnxruntime_server::transport::http::https_session::get_remote_endpoint() {
-	if (_remote_endpoint.empty())
-		_remote_endpoint = stream.lowest_layer().remote_endpoint().address().to_string() + ":" +
-						   std::to_string(stream.lowest_layer().remote_endpoint().port());
+	if (_remote_endpoint.empty()) {
+		boost::system::error_code ec;
+		auto endpoint = stream.lowest_layer().remote_endpoint(ec);
+		_remote_endpoint = endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+	}
 
 	return _remote_endpoint;
 }
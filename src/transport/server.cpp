@@ -22,10 +22,8 @@ Orts::transport::server::~server() {
 
 void Orts::transport::server::accept() {
 	acceptor.async_accept(socket, [this](boost::system::error_code ec) {
-		if (!ec) {
-			std::thread([this](asio::socket sock) { this->client_connected(std::move(sock)); }, std::move(socket))
-				.detach();
-		}
+		if (!ec)
+			client_connected(std::move(socket));
 		accept();
 	});
 }
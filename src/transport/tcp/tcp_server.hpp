@@ -23,6 +23,27 @@
 
 #define MAX_RECV_BUF_LENGTH (1024 * 1024 * 4)
 
+// the low byte of protocol_header.type is the task type. flag bits above it select the encoding of the json part
+// and are echoed back in the response type
+#define TCP_TYPE_TASK_MASK 0x00FF
+#define TCP_TYPE_FORMAT_MASK 0x0300
+#define TCP_TYPE_FORMAT_MSGPACK 0x0100
+#define TCP_TYPE_FORMAT_CBOR 0x0200
+// a request with this flag is followed by an int64 request id (network byte order, not counted in length). it is
+// handled concurrently with other tagged requests of the connection, and its response carries the same flag and id.
+// errors of tagged requests use TCP_TYPE_TAGGED_ERROR instead of -1
+#define TCP_TYPE_FLAG_REQUEST_ID 0x1000
+#define TCP_TYPE_TAGGED_ERROR (TCP_TYPE_FLAG_REQUEST_ID | TCP_TYPE_TASK_MASK)
+// worker queue lane of the request. without either flag, execute requests follow the priority option and NUMA node of
+// the session and other tagged requests are queued as normal
+#define TCP_TYPE_PRIORITY_MASK 0x0C00
+#define TCP_TYPE_PRIORITY_HIGH 0x0400
+#define TCP_TYPE_PRIORITY_LOW 0x0800
+// a request with this flag is followed by a uint32 timeout in milliseconds (network byte order, not counted in length),
+// after the request id if it has one. an execute request is given up that long after it arrived. the flag is not
+// echoed in the response
+#define TCP_TYPE_FLAG_TIMEOUT 0x2000
+
 namespace onnxruntime_server::transport::tcp {
 	PACKED_STRUCT(protocol_header) {
 		int16_t type;
@@ -31,42 +52,62 @@ namespace onnxruntime_server::transport::tcp {
 		int64_t post_length;
 	};
 
+	struct tcp_request {
+		protocol_header header;
+		bool has_request_id = false;
+		int64_t request_id = 0;
+		// 0 follows the timeout_ms of the JSON part, then the timeout_ms option of the session
+		uint32_t timeout_ms = 0;
+		std::string body;
+		// request timeouts count from here, so time spent waiting for a worker is included
+		std::chrono::steady_clock::time_point received_at;
+	};
+
 	class tcp_session {
 	  private:
 		asio::socket socket;
 		std::string chunk;
-		std::string buffer;
 
-		onnxruntime_server::task::benchmark request_time;
+		std::mutex write_mutex;
+		std::mutex in_flight_mutex;
+		std::condition_variable in_flight_done;
+		long in_flight = 0;
+
 		std::string _remote_endpoint;
 
-		std::optional<protocol_header> do_read();
-		bool do_write(protocol_header &header, const std::string &buf);
+		std::optional<tcp_request> do_read();
+		bool do_write(protocol_header &header, const tcp_request &req, const std::string &buf);
+		void handle(onnx::session_manager &session_manager, const tcp_request &req);
+		std::shared_ptr<onnxruntime_server::task::task>
+		parse(onnx::session_manager &session_manager, const tcp_request &req);
+		void respond(const tcp_request &req, onnxruntime_server::task::task &task);
 
+		static onnx::execution::payload_format type_to_format(int16_t type);
 		static std::shared_ptr<onnxruntime_server::task::task> create_task(
 			onnx::session_manager &onnx_session_manager, int16_t type, const json &request_json, const char *post,
 			size_t post_length
 		);
+		static std::optional<task_priority> type_to_priority(int16_t type);
 
 	  public:
 		explicit tcp_session(asio::socket socket);
 		void run(onnx::session_manager &session_manager);
 
-		bool send_error(std::string type, std::string what);
+		bool send_error(const tcp_request &req, std::string type, std::string what);
 		std::string get_remote_endpoint();
 	};
 
 	class tcp_server : public server {
 	  protected:
 		void client_connected(asio::socket socket) override {
-			tcp_session(std::move(socket)).run(get_onnx_session_manager());
-
-			try {
-				socket.close();
-				PLOG(L_INFO) << "transport::tcp::tcp_server: worker killed" << std::endl;
-			} catch (std::exception &e) {
-				PLOG(L_WARNING) << "transport::tcp::tcp_server: socket close error " << e.what() << std::endl;
-			}
+			std::thread(
+				[this](asio::socket socket) {
+					tcp_session(std::move(socket)).run(get_onnx_session_manager());
+					PLOG(L_INFO) << "transport::tcp::tcp_server: worker killed" << std::endl;
+				},
+				std::move(socket)
+			)
+				.detach();
 		}
 
 	  public:
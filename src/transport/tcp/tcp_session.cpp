@@ -14,48 +14,124 @@ void Orts::transport::tcp::tcp_session::run(onnx::session_manager &session_manag
 		if (!req.has_value())
 			break;
 
-		try {
-			auto header = req.value();
-
-			auto cstr = buffer.c_str();
-			auto json = header.json_length > 0 ? json::parse(cstr, cstr + header.json_length) : json::object();
-			auto post = header.post_length > 0 ? cstr + header.json_length : nullptr;
-
-			// create task
-			request_time.touch();
-			auto task = create_task(session_manager, header.type, json, post, header.post_length);
-			auto result = task->run();
-
-			PLOG(L_INFO, "ACCESS") << get_remote_endpoint() << " task: " << task->name()
-								   << " duration: " << request_time.get_duration() << std::endl;
-
-			auto res_json = result.dump();
-			protocol_header res_header = {0, 0, 0, 0};
-			res_header.type = htons(header.type);
-			res_header.json_length = HTONLL(res_json.size());
-			res_header.post_length = HTONLL(0);
-			res_header.length = res_header.json_length;
+		if (!req->has_request_id) {
+			handle(session_manager, req.value());
+			continue;
+		}
 
-			if (!do_write(res_header, res_json))
-				break;
+		// tagged requests run concurrently on the worker pool and answer out of order. they are parsed here, so that
+		// an execute request is queued on the lane and NUMA node of its session
+		{
+			std::lock_guard<std::mutex> lock(in_flight_mutex);
+			in_flight++;
+		}
+		auto tagged = std::make_shared<tcp_request>(std::move(req.value()));
+		auto finish = [this]() {
+			std::lock_guard<std::mutex> lock(in_flight_mutex);
+			if (--in_flight == 0)
+				in_flight_done.notify_all();
+		};
+		try {
+			auto task = parse(session_manager, *tagged);
+			auto placement = task_placement(type_to_priority(tagged->header.type).value_or(task_priority::normal));
+			if (auto execute = std::dynamic_pointer_cast<task::execute_session>(task))
+				placement = execute->placement();
+			session_manager.thread_pool.post(placement, [this, tagged, task, finish]() {
+				respond(*tagged, *task);
+				finish();
+			});
 		} catch (Orts::exception &e) {
+			// an invalid request, or rejected by admission control
 			PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
-			send_error(e.type(), e.what());
+			send_error(*tagged, e.type(), e.what());
+			finish();
 		} catch (std::exception &e) {
 			PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
-			send_error("runtime_error", e.what());
+			send_error(*tagged, "runtime_error", e.what());
+			finish();
 		}
 	}
+
+	// workers still hold this session until their responses are written
+	std::unique_lock<std::mutex> lock(in_flight_mutex);
+	in_flight_done.wait(lock, [this] { return in_flight == 0; });
+}
+
+void Orts::transport::tcp::tcp_session::handle(onnx::session_manager &session_manager, const tcp_request &req) {
+	std::shared_ptr<task::task> task;
+	try {
+		task = parse(session_manager, req);
+	} catch (Orts::exception &e) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
+		send_error(req, e.type(), e.what());
+		return;
+	} catch (std::exception &e) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
+		send_error(req, "runtime_error", e.what());
+		return;
+	}
+	respond(req, *task);
+}
+
+std::shared_ptr<Orts::task::task>
+Orts::transport::tcp::tcp_session::parse(onnx::session_manager &session_manager, const tcp_request &req) {
+	auto &header = req.header;
+	auto format = type_to_format(header.type);
+	auto cstr = req.body.c_str();
+
+	// the inputs of an execute request are decoded into tensors straight from the body when it runs
+	if ((header.type & TCP_TYPE_TASK_MASK) == Orts::task::EXECUTE_SESSION) {
+		auto task = std::make_shared<Orts::task::execute_session>(session_manager, cstr, header.json_length, format);
+		task->received_at = req.received_at;
+		task->priority = type_to_priority(header.type);
+		if (req.timeout_ms > 0)
+			task->timeout_ms = req.timeout_ms;
+		return task;
+	}
+
+	auto json = header.json_length > 0 ? onnx::execution::decode_payload(cstr, header.json_length, format)
+									   : json::object();
+	auto post = header.post_length > 0 ? cstr + header.json_length : nullptr;
+
+	return create_task(session_manager, header.type, json, post, header.post_length);
 }
 
-std::optional<Orts::transport::tcp::protocol_header> Orts::transport::tcp::tcp_session::do_read() {
-	buffer.clear();
+void Orts::transport::tcp::tcp_session::respond(const tcp_request &req, task::task &task) {
+	try {
+		auto &header = req.header;
+		auto format = type_to_format(header.type);
+
+		task::benchmark request_time;
+		request_time.touch();
+		auto result = task.run();
+
+		PLOG(L_INFO, "ACCESS") << get_remote_endpoint() << " task: " << task.name()
+							   << " duration: " << request_time.get_duration() << std::endl;
+
+		auto res_json = onnx::execution::encode_payload(result, format);
+		protocol_header res_header = {0, 0, 0, 0};
+		res_header.type = htons(header.type & ~TCP_TYPE_FLAG_TIMEOUT);
+		res_header.json_length = HTONLL(res_json.size());
+		res_header.post_length = HTONLL(0);
+		res_header.length = res_header.json_length;
+
+		do_write(res_header, req, res_json);
+	} catch (Orts::exception &e) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
+		send_error(req, e.type(), e.what());
+	} catch (std::exception &e) {
+		PLOG(L_WARNING) << get_remote_endpoint() << " transport::tcp_session::execute: " << e.what() << std::endl;
+		send_error(req, "runtime_error", e.what());
+	}
+}
 
+std::optional<Orts::transport::tcp::tcp_request> Orts::transport::tcp::tcp_session::do_read() {
+	tcp_request req;
 	boost::system::error_code ec;
 
 	// process header
-	protocol_header header = {0, 0, 0, 0};
-	std::size_t length = socket.read_some(boost::asio::buffer(&header, sizeof(protocol_header)), ec);
+	auto &header = req.header;
+	std::size_t length = boost::asio::read(socket, boost::asio::buffer(&header, sizeof(protocol_header)), ec);
 	if (length < sizeof(protocol_header) || ec.value())
 		return std::nullopt;
 
@@ -64,6 +140,24 @@ std::optional<Orts::transport::tcp::protocol_header> Orts::transport::tcp::tcp_s
 	header.json_length = NTOHLL(header.json_length);
 	header.post_length = NTOHLL(header.post_length);
 
+	// -1 is the legacy error type and has every flag bit set
+	if (header.type != -1 && (header.type & TCP_TYPE_FLAG_REQUEST_ID)) {
+		int64_t request_id = 0;
+		length = boost::asio::read(socket, boost::asio::buffer(&request_id, sizeof(request_id)), ec);
+		if (length < sizeof(request_id) || ec.value())
+			return std::nullopt;
+		req.has_request_id = true;
+		req.request_id = NTOHLL(request_id);
+	}
+	if (header.type != -1 && (header.type & TCP_TYPE_FLAG_TIMEOUT)) {
+		uint32_t timeout_ms = 0;
+		length = boost::asio::read(socket, boost::asio::buffer(&timeout_ms, sizeof(timeout_ms)), ec);
+		if (length < sizeof(timeout_ms) || ec.value())
+			return std::nullopt;
+		req.timeout_ms = ntohl(timeout_ms);
+	}
+
+	auto &buffer = req.body;
 	while (buffer.size() < header.length) {
 		length = socket.read_some(
 			boost::asio::buffer(chunk.data(), NUM_MIN(MAX_RECV_BUF_LENGTH, header.length - buffer.length())), ec
@@ -73,43 +167,59 @@ std::optional<Orts::transport::tcp::protocol_header> Orts::transport::tcp::tcp_s
 
 		buffer.append(chunk.data(), length);
 	}
-	return header;
+	req.received_at = std::chrono::steady_clock::now();
+	return req;
 }
 
 #undef MAX_LENGTH
 #undef MAX_BUFFER_LIMIT
 
-bool onnxruntime_server::transport::tcp::tcp_session::send_error(std::string type, std::string what) {
+bool onnxruntime_server::transport::tcp::tcp_session::send_error(
+	const tcp_request &req, std::string type, std::string what
+) {
 	auto res_json = Orts::exception::what_to_json(type, what);
 	struct protocol_header res_header = {0, 0, 0, 0};
-	res_header.type = htons(-1);
+	res_header.type = htons(req.has_request_id ? TCP_TYPE_TAGGED_ERROR : -1);
 	res_header.json_length = HTONLL(res_json.size());
 	res_header.post_length = HTONLL(0);
 	res_header.length = res_header.json_length;
 
-	return do_write(res_header, res_json);
+	return do_write(res_header, req, res_json);
 }
 
 bool Orts::transport::tcp::tcp_session::do_write(
-	Orts::transport::tcp::protocol_header &header, const std::string &buf
+	Orts::transport::tcp::protocol_header &header, const tcp_request &req, const std::string &buf
 ) {
+	int64_t request_id = HTONLL(req.request_id);
+	std::vector<boost::asio::const_buffer> buffers;
+	buffers.emplace_back(boost::asio::buffer(&header, sizeof(Orts::transport::tcp::protocol_header)));
+	if (req.has_request_id)
+		buffers.emplace_back(boost::asio::buffer(&request_id, sizeof(request_id)));
+	buffers.emplace_back(boost::asio::buffer(buf));
+
+	// responses of concurrent requests must not interleave
+	std::lock_guard<std::mutex> lock(write_mutex);
 	boost::system::error_code ec;
-	std::size_t sent = socket.write_some(
-		std::array<boost::asio::const_buffer, 2>{
-			boost::asio::buffer(&header, sizeof(Orts::transport::tcp::protocol_header)), boost::asio::buffer(buf)
-		},
-		ec
-	);
+	std::size_t sent = boost::asio::write(socket, buffers, ec);
 	return !ec && sent > 0;
 }
 
+Orts::onnx::execution::payload_format Orts::transport::tcp::tcp_session::type_to_format(int16_t type) {
+	switch (type & TCP_TYPE_FORMAT_MASK) {
+	case TCP_TYPE_FORMAT_MSGPACK:
+		return onnx::execution::PAYLOAD_MSGPACK;
+	case TCP_TYPE_FORMAT_CBOR:
+		return onnx::execution::PAYLOAD_CBOR;
+	default:
+		return onnx::execution::PAYLOAD_JSON;
+	}
+}
+
 std::shared_ptr<Orts::task::task> onnxruntime_server::transport::tcp::tcp_session::create_task(
 	onnx::session_manager &onnx_session_manager, int16_t type, const json &request_json, const char *post,
 	size_t post_length
 ) {
-	switch (type) {
-	case Orts::task::EXECUTE_SESSION:
-		return std::make_shared<Orts::task::execute_session>(onnx_session_manager, request_json);
+	switch (type & TCP_TYPE_TASK_MASK) {
 	case Orts::task::GET_SESSION:
 		return std::make_shared<Orts::task::get_session>(onnx_session_manager, request_json);
 	case Orts::task::CREATE_SESSION:
@@ -123,6 +233,19 @@ std::shared_ptr<Orts::task::task> onnxruntime_server::transport::tcp::tcp_sessio
 	}
 }
 
+std::optional<Orts::task_priority> onnxruntime_server::transport::tcp::tcp_session::type_to_priority(int16_t type) {
+	switch (type & TCP_TYPE_PRIORITY_MASK) {
+	case TCP_TYPE_PRIORITY_HIGH:
+		return task_priority::high;
+	case TCP_TYPE_PRIORITY_LOW:
+		return task_priority::low;
+	case 0:
+		return std::nullopt;
+	default:
+		throw bad_request_error("Invalid priority flags");
+	}
+}
+
 std::string onnxruntime_server::transport::tcp::tcp_session::get_remote_endpoint() {
 	if (_remote_endpoint.empty())
 		_remote_endpoint =
@@ -62,6 +62,28 @@ namespace onnxruntime_server {
 		}
 	};
 
+	class service_unavailable_error : public exception {
+	  public:
+		explicit service_unavailable_error(const std::string &what_arg)
+			: exception(http::status::service_unavailable, what_arg) {
+		}
+
+		std::string type() override {
+			return "service_unavailable_error";
+		}
+	};
+
+	class gateway_timeout_error : public exception {
+	  public:
+		explicit gateway_timeout_error(const std::string &what_arg)
+			: exception(http::status::gateway_timeout, what_arg) {
+		}
+
+		std::string type() override {
+			return "gateway_timeout_error";
+		}
+	};
+
 	class runtime_error : public exception {
 	  public:
 		explicit runtime_error(const std::string &what_arg) : exception(http::status::internal_server_error, what_arg) {